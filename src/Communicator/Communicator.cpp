@@ -1,5 +1,6 @@
 #include <cstdarg>
 #include <numeric>
+#include <algorithm>
 
 #include <mpi.h>
 
@@ -8,14 +9,26 @@
 
 MPI_Datatype Communicator::MPI_VECTOR2D_;
 MPI_Datatype Communicator::MPI_TENSOR2D_;
+MPI_Datatype Communicator::MPI_REDUCTION_ENTRY_;
+MPI_Op Communicator::MPI_BATCHED_REDUCTION_;
 
 void Communicator::init(int argc, char *argv[])
 {
-    MPI_Init(&argc, &argv);
+    //- Only the master thread of each process communicates, worker threads are confined to compute loops
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+
+    if(provided < MPI_THREAD_FUNNELED)
+        throw Exception("Communicator", "init", "MPI implementation does not support MPI_THREAD_FUNNELED.");
+
     MPI_Type_vector(1, 2, 2, MPI_DOUBLE, &MPI_VECTOR2D_);
     MPI_Type_vector(1, 4, 4, MPI_DOUBLE, &MPI_TENSOR2D_);
     MPI_Type_commit(&MPI_VECTOR2D_);
     MPI_Type_commit(&MPI_TENSOR2D_);
+
+    MPI_Type_contiguous(2, MPI_DOUBLE, &MPI_REDUCTION_ENTRY_);
+    MPI_Type_commit(&MPI_REDUCTION_ENTRY_);
+    MPI_Op_create(&Communicator::reduceEntries, 1, &MPI_BATCHED_REDUCTION_);
 }
 
 void Communicator::finalize()
@@ -32,7 +45,11 @@ Communicator::Communicator(MPI_Comm comm)
 
 Communicator::~Communicator()
 {
+    int finalized;
+    MPI_Finalized(&finalized);
 
+    if (ownsComm_ && !finalized)
+        MPI_Comm_free(&comm_);
 }
 
 int Communicator::printf(const char *format, ...) const
@@ -306,6 +323,198 @@ void Communicator::waitAll() const
     currentRequests_.clear();
 }
 
+void Communicator::wait(MPI_Request &request) const
+{
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+}
+
+void Communicator::waitAll(std::vector<MPI_Request> &requests) const
+{
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    requests.clear();
+}
+
+MPI_Request Communicator::isignal(int dest, int tag) const
+{
+    MPI_Request request;
+    MPI_Isend(nullptr, 0, MPI_BYTE, dest, tag, comm_, &request);
+    return request;
+}
+
+MPI_Request Communicator::irecvSignal(int source, int tag) const
+{
+    MPI_Request request;
+    MPI_Irecv(nullptr, 0, MPI_BYTE, source, tag, comm_, &request);
+    return request;
+}
+
+std::shared_ptr<Communicator> Communicator::createNeighbourhood(const std::vector<int> &neighbours) const
+{
+    MPI_Comm graphComm;
+    MPI_Dist_graph_create_adjacent(comm_,
+                                   neighbours.size(), neighbours.data(), MPI_UNWEIGHTED,
+                                   neighbours.size(), neighbours.data(), MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL, 0, &graphComm);
+
+    auto comm = std::make_shared<Communicator>(graphComm);
+    comm->ownsComm_ = true;
+    comm->neighbours_ = neighbours;
+
+    return comm;
+}
+
+MPI_Request Communicator::ineighbourAllToAllv(const std::vector<double> &sendBuffer,
+                                              const std::vector<int> &sendCounts,
+                                              const std::vector<int> &sendDispls,
+                                              std::vector<double> &recvBuffer,
+                                              const std::vector<int> &recvCounts,
+                                              const std::vector<int> &recvDispls) const
+{
+    MPI_Request request;
+    MPI_Ineighbor_alltoallv(sendBuffer.data(), sendCounts.data(), sendDispls.data(), MPI_DOUBLE,
+                            recvBuffer.data(), recvCounts.data(), recvDispls.data(), MPI_DOUBLE,
+                            comm_, &request);
+
+    return request;
+}
+
+std::vector<int> Communicator::neighbourAllToAll(const std::vector<int> &vals) const
+{
+    std::vector<int> result(neighbours_.size());
+    MPI_Neighbor_alltoall(vals.data(), 1, MPI_INT, result.data(), 1, MPI_INT, comm_);
+    return result;
+}
+
+std::shared_ptr<Communicator> Communicator::createGroupComm(const std::vector<int> &ranks, int tag) const
+{
+    MPI_Group group, subGroup;
+    MPI_Comm_group(comm_, &group);
+    MPI_Group_incl(group, ranks.size(), ranks.data(), &subGroup);
+
+    MPI_Comm subComm;
+    MPI_Comm_create_group(comm_, subGroup, tag, &subComm);
+
+    MPI_Group_free(&group);
+    MPI_Group_free(&subGroup);
+
+    auto comm = std::make_shared<Communicator>(subComm);
+    comm->ownsComm_ = true;
+
+    return comm;
+}
+
+std::vector<std::pair<int, std::vector<double>>> Communicator::sparseExchange(
+        const std::vector<std::pair<int, std::vector<double>>> &messages, int tag) const
+{
+    //- Synchronous sends complete only once matched, so a proc whose sends are done and that has passed the
+    //- barrier knows that every message meant for it has arrived
+    std::vector<MPI_Request> sendRequests(messages.size());
+
+    for (int i = 0; i < messages.size(); ++i)
+        MPI_Issend(messages[i].second.data(), messages[i].second.size(), MPI_DOUBLE, messages[i].first, tag, comm_,
+                   &sendRequests[i]);
+
+    std::vector<std::pair<int, std::vector<double>>> received;
+    MPI_Request barrier;
+    bool barrierStarted = false;
+    int done = 0;
+
+    while (!done)
+    {
+        int flag;
+        MPI_Status status;
+        MPI_Iprobe(MPI_ANY_SOURCE, tag, comm_, &flag, &status);
+
+        if (flag)
+        {
+            int count;
+            MPI_Get_count(&status, MPI_DOUBLE, &count);
+
+            received.push_back(std::make_pair(status.MPI_SOURCE, std::vector<double>(count)));
+            MPI_Recv(received.back().second.data(), count, MPI_DOUBLE, status.MPI_SOURCE, tag, comm_,
+                     MPI_STATUS_IGNORE);
+        }
+
+        if (barrierStarted)
+            MPI_Test(&barrier, &done, MPI_STATUS_IGNORE);
+        else
+        {
+            int sent;
+            MPI_Testall(sendRequests.size(), sendRequests.data(), &sent, MPI_STATUSES_IGNORE);
+
+            if (sent)
+            {
+                MPI_Ibarrier(comm_, &barrier);
+                barrierStarted = true;
+            }
+        }
+    }
+
+    return received;
+}
+
+std::shared_ptr<Communicator> Communicator::createSharedMemoryComm() const
+{
+    MPI_Comm sharedComm;
+    MPI_Comm_split_type(comm_, MPI_COMM_TYPE_SHARED, rank(), MPI_INFO_NULL, &sharedComm);
+
+    auto comm = std::make_shared<Communicator>(sharedComm);
+    comm->ownsComm_ = true;
+
+    return comm;
+}
+
+std::vector<int> Communicator::translateRanks(const std::vector<int> &ranks, const Communicator &other) const
+{
+    MPI_Group group, otherGroup;
+    MPI_Comm_group(comm_, &group);
+    MPI_Comm_group(other.comm_, &otherGroup);
+
+    std::vector<int> result(ranks.size());
+    MPI_Group_translate_ranks(group, ranks.size(), ranks.data(), otherGroup, result.data());
+
+    MPI_Group_free(&group);
+    MPI_Group_free(&otherGroup);
+
+    return result;
+}
+
+MPI_Win Communicator::allocateSharedWindow(Size size, double *&basePtr) const
+{
+    MPI_Win win;
+    MPI_Win_allocate_shared(size * sizeof(double), sizeof(double), MPI_INFO_NULL, comm_, &basePtr, &win);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+
+    return win;
+}
+
+double *Communicator::sharedWindowPtr(MPI_Win win, int rank) const
+{
+    MPI_Aint size;
+    int dispUnit;
+    double *ptr;
+    MPI_Win_shared_query(win, rank, &size, &dispUnit, &ptr);
+
+    return ptr;
+}
+
+void Communicator::syncWindow(MPI_Win win) const
+{
+    MPI_Win_sync(win);
+}
+
+void Communicator::freeWindow(MPI_Win &win) const
+{
+    int finalized;
+    MPI_Finalized(&finalized);
+
+    if (win == MPI_WIN_NULL || finalized)
+        return;
+
+    MPI_Win_unlock_all(win);
+    MPI_Win_free(&win);
+}
+
 template<>
 int Communicator::probeSize<unsigned long>(int source, int tag) const
 {
@@ -386,3 +595,33 @@ double Communicator::max(double val) const
     return result;
 }
 
+MPI_Request Communicator::iallReduce(std::vector<ReductionEntry> &entries) const
+{
+    MPI_Request request;
+    MPI_Iallreduce(MPI_IN_PLACE, entries.data(), entries.size(), MPI_REDUCTION_ENTRY_, MPI_BATCHED_REDUCTION_, comm_, &request);
+
+    return request;
+}
+
+//- Private static methods
+
+void Communicator::reduceEntries(void *in, void *inout, int *len, MPI_Datatype *type)
+{
+    const ReductionEntry *a = static_cast<const ReductionEntry*>(in);
+    ReductionEntry *b = static_cast<ReductionEntry*>(inout);
+
+    for (int i = 0; i < *len; ++i)
+        switch ((int) b[i].op)
+        {
+            case SUM:
+                b[i].val += a[i].val;
+                break;
+            case MIN:
+                b[i].val = std::min(a[i].val, b[i].val);
+                break;
+            case MAX:
+                b[i].val = std::max(a[i].val, b[i].val);
+                break;
+        }
+}
+
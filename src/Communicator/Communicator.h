@@ -3,6 +3,7 @@
 
 #include <mpi.h>
 #include <vector>
+#include <memory>
 
 #include "Vector2D.h"
 #include "Tensor2D.h"
@@ -11,12 +12,25 @@ class Communicator
 {
 public:
 
+    enum ReductionOp {SUM, MIN, MAX};
+
+    //- A single entry of a batched reduction, the op is stored alongside the value
+    struct ReductionEntry
+    {
+        double val, op;
+    };
+
     static void init(int argc, char *argv[]);
 
     static void finalize();
 
     Communicator(MPI_Comm comm = MPI_COMM_WORLD);
 
+    //- May own its MPI communicator, which must be freed exactly once
+    Communicator(const Communicator &) = delete;
+
+    Communicator &operator=(const Communicator &) = delete;
+
     ~Communicator();
 
     //- Printing
@@ -115,6 +129,53 @@ public:
 
     void waitAll() const;
 
+    void wait(MPI_Request &request) const;
+
+    void waitAll(std::vector<MPI_Request> &requests) const;
+
+    //- Zero-size messages used only for synchronization
+    MPI_Request isignal(int dest, int tag) const;
+
+    MPI_Request irecvSignal(int source, int tag) const;
+
+    //- Neighbourhood communication
+    std::shared_ptr<Communicator> createNeighbourhood(const std::vector<int> &neighbours) const;
+
+    const std::vector<int> &neighbours() const
+    { return neighbours_; }
+
+    MPI_Request ineighbourAllToAllv(const std::vector<double> &sendBuffer,
+                                    const std::vector<int> &sendCounts,
+                                    const std::vector<int> &sendDispls,
+                                    std::vector<double> &recvBuffer,
+                                    const std::vector<int> &recvCounts,
+                                    const std::vector<int> &recvDispls) const;
+
+    std::vector<int> neighbourAllToAll(const std::vector<int> &vals) const;
+
+    //- Collective over the listed ranks only, which must all call it with the same ranks and tag
+    std::shared_ptr<Communicator> createGroupComm(const std::vector<int> &ranks, int tag) const;
+
+    //- Sparse exchange of messages whose receivers do not know their senders. Collective, but only a
+    //- non-blocking barrier is exchanged besides the messages. Returns the received messages with their sources
+    std::vector<std::pair<int, std::vector<double>>> sparseExchange(
+            const std::vector<std::pair<int, std::vector<double>>> &messages, int tag) const;
+
+    //- Shared memory
+    std::shared_ptr<Communicator> createSharedMemoryComm() const;
+
+    //- Map ranks in this communicator to ranks in other, MPI_UNDEFINED for ranks not in other
+    std::vector<int> translateRanks(const std::vector<int> &ranks, const Communicator &other) const;
+
+    //- Collective, the window is locked for passive target access until it is freed
+    MPI_Win allocateSharedWindow(Size size, double *&basePtr) const;
+
+    double *sharedWindowPtr(MPI_Win win, int rank) const;
+
+    void syncWindow(MPI_Win win) const;
+
+    void freeWindow(MPI_Win &win) const;
+
     //- Dynamic
 
     template <typename T>
@@ -135,11 +196,19 @@ public:
 
     double max(double val) const;
 
+    //- Reduces entries with mixed operations in place, using a single non-blocking all-reduce
+    MPI_Request iallReduce(std::vector<ReductionEntry> &entries) const;
+
 private:
 
-    static MPI_Datatype MPI_VECTOR2D_, MPI_TENSOR2D_;
+    static void reduceEntries(void *in, void *inout, int *len, MPI_Datatype *type);
+
+    static MPI_Datatype MPI_VECTOR2D_, MPI_TENSOR2D_, MPI_REDUCTION_ENTRY_;
+    static MPI_Op MPI_BATCHED_REDUCTION_;
 
     MPI_Comm comm_;
+    bool ownsComm_ = false;
+    std::vector<int> neighbours_;
     mutable std::vector<MPI_Request> currentRequests_;
 };
 
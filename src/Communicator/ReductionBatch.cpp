@@ -0,0 +1,79 @@
+#include "ReductionBatch.h"
+
+Scalar ReductionBatch::Result::get() const
+{
+    state_->wait();
+    return state_->entries[index_].val;
+}
+
+ReductionBatch::ReductionBatch(const Communicator &comm)
+        :
+        comm_(comm),
+        state_(std::make_shared<State>(comm))
+{
+
+}
+
+ReductionBatch::Result ReductionBatch::sum(Scalar val)
+{
+    return add(val, Communicator::SUM);
+}
+
+ReductionBatch::Result ReductionBatch::min(Scalar val)
+{
+    return add(val, Communicator::MIN);
+}
+
+ReductionBatch::Result ReductionBatch::max(Scalar val)
+{
+    return add(val, Communicator::MAX);
+}
+
+void ReductionBatch::start()
+{
+    state_->start();
+}
+
+void ReductionBatch::wait()
+{
+    state_->wait();
+}
+
+//- Private methods
+
+ReductionBatch::Result ReductionBatch::add(Scalar val, Communicator::ReductionOp op)
+{
+    //- Outstanding results keep their state alive
+    if (state_->started)
+        state_ = std::make_shared<State>(comm_);
+
+    state_->entries.push_back(Communicator::ReductionEntry{val, (double) op});
+    return Result(state_, state_->entries.size() - 1);
+}
+
+ReductionBatch::State::~State()
+{
+    //- The entries must outlive a started reduction
+    if (started && !completed)
+        comm.wait(request);
+}
+
+void ReductionBatch::State::start()
+{
+    if (started)
+        return;
+
+    request = comm.iallReduce(entries);
+    started = true;
+}
+
+void ReductionBatch::State::wait()
+{
+    start();
+
+    if (!completed)
+    {
+        comm.wait(request);
+        completed = true;
+    }
+}
@@ -0,0 +1,77 @@
+#ifndef REDUCTION_BATCH_H
+#define REDUCTION_BATCH_H
+
+#include <memory>
+
+#include "Communicator.h"
+
+class ReductionBatch
+{
+    struct State;
+
+public:
+
+    //- Handle to a reduction result, waits for the batch when the value is requested
+    class Result
+    {
+    public:
+
+        Result()
+        {}
+
+        bool valid() const
+        { return (bool) state_; }
+
+        Scalar get() const;
+
+    private:
+
+        friend class ReductionBatch;
+
+        Result(const std::shared_ptr<State> &state, Label index) : state_(state), index_(index)
+        {}
+
+        std::shared_ptr<State> state_;
+        Label index_ = 0;
+    };
+
+    ReductionBatch(const Communicator &comm);
+
+    //- Enqueue reductions
+    Result sum(Scalar val);
+
+    Result min(Scalar val);
+
+    Result max(Scalar val);
+
+    //- Resolve all enqueued reductions in one non-blocking all-reduce. New reductions start a new batch
+    void start();
+
+    void wait();
+
+private:
+
+    struct State
+    {
+        State(const Communicator &comm) : comm(comm)
+        {}
+
+        ~State();
+
+        void start();
+
+        void wait();
+
+        const Communicator &comm;
+        std::vector<Communicator::ReductionEntry> entries;
+        MPI_Request request;
+        bool started = false, completed = false;
+    };
+
+    Result add(Scalar val, Communicator::ReductionOp op);
+
+    const Communicator &comm_;
+    std::shared_ptr<State> state_;
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include "Cicsam.h"
 #include "Algorithm.h"
+#include "Vof.h"
 
 ScalarFiniteVolumeField cicsam::beta(const VectorFiniteVolumeField &u,
                                      const VectorFiniteVolumeField &gradGamma,
@@ -8,7 +9,21 @@ ScalarFiniteVolumeField cicsam::beta(const VectorFiniteVolumeField &u,
                                      Scalar k)
 {
     ScalarFiniteVolumeField beta(gamma.gridPtr(), "beta");
+    ScalarFiniteVolumeField gammaF(gamma.gridPtr(), "gammaF");
 
+    cicsam::beta(u, gradGamma, gamma, timeStep, beta, gammaF, k);
+
+    return beta;
+}
+
+void cicsam::beta(const VectorFiniteVolumeField &u,
+                  const VectorFiniteVolumeField &gradGamma,
+                  const ScalarFiniteVolumeField &gamma,
+                  Scalar timeStep,
+                  ScalarFiniteVolumeField &beta,
+                  ScalarFiniteVolumeField &gammaF,
+                  Scalar k)
+{
     auto hc = [](Scalar gammaDTilde, Scalar coD) {
         return gammaDTilde >= 0 && gammaDTilde <= 1 ? std::min(1., gammaDTilde / coD) : gammaDTilde;
     };
@@ -19,40 +34,36 @@ ScalarFiniteVolumeField cicsam::beta(const VectorFiniteVolumeField &u,
                gammaDTilde;
     };
 
+    vof::faceKernel(u, gradGamma, gamma, timeStep, beta, gammaF,
+                    [k, &hc, &uq](Scalar gammaDTilde, Scalar coD, Scalar cosThetaF) {
+                        //- (cos(2 thetaF) + 1) / 2 = cos(thetaF)^2, so no trigonometric functions are needed
+                        Scalar psiF = std::min(k * cosThetaF * cosThetaF, 1.);
+                        return psiF * hc(gammaDTilde, coD) + (1. - psiF) * uq(gammaDTilde, coD);
+                    });
+}
+
+Equation<Scalar> cicsam::div(const VectorFiniteVolumeField &u,
+                             const ScalarFiniteVolumeField &beta,
+                             ScalarFiniteVolumeField &gamma,
+                             const CellGroup &cells,
+                             Scalar theta)
+{
+    ScalarFiniteVolumeField gammaF(gamma.gridPtr(), "gammaF");
+
     for (const Face &face: gamma.grid().interiorFaces())
     {
-        Vector2D sf = face.outwardNorm(face.lCell().centroid());
-        Scalar flux = dot(u(face), sf);
+        Scalar flux = dot(u(face), face.outwardNorm(face.lCell().centroid()));
         const Cell &donor = flux >= 0. ? face.lCell() : face.rCell();
         const Cell &acceptor = flux >= 0. ? face.rCell() : face.lCell();
-        Vector2D rc = acceptor.centroid() - donor.centroid();
-
-        Scalar gammaD = clamp(gamma(donor), 0., 1.);
-        Scalar gammaA = clamp(gamma(acceptor), 0., 1.);
-        Scalar gammaU = clamp(gammaA - 2. * dot(rc, gradGamma(donor)), 0., 1.);
-        Scalar gammaDTilde = (gammaD - gammaU) / (gammaA - gammaU);
-
-        Scalar coD = 0.; //- Cell courant number
-        for (const InteriorLink &nb: donor.neighbours())
-            coD += std::max(dot(u(nb.face()), nb.outwardNorm()) / donor.volume() * timeStep, 0.);
-
-        for (const BoundaryLink &bd: donor.boundaries())
-            coD += std::max(dot(u(bd.face()), bd.outwardNorm()) / donor.volume() * timeStep, 0.);
-
-        Scalar thetaF = std::acos(std::abs(dot(gradGamma(donor).unitVec(), rc.unitVec())));
-        Scalar psiF = std::min(k * (std::cos(2 * thetaF) + 1.) / 2., 1.);
-        Scalar gammaFTilde = psiF * hc(gammaDTilde, coD) + (1. - psiF) * uq(gammaDTilde, coD);
-        Scalar betaFace = (gammaFTilde - gammaDTilde) / (1. - gammaDTilde);
-
-        //- If stencil cannot be computed, default to upwind
-        beta(face) = std::isnan(betaFace) ? 0. : clamp(betaFace, 0., 1.);
+        gammaF(face) = (1. - beta(face)) * gamma(donor) + beta(face) * gamma(acceptor);
     }
 
-    return beta;
+    return div(u, beta, gammaF, gamma, cells, theta);
 }
 
 Equation<Scalar> cicsam::div(const VectorFiniteVolumeField &u,
                              const ScalarFiniteVolumeField &beta,
+                             const ScalarFiniteVolumeField &gammaF,
                              ScalarFiniteVolumeField &gamma,
                              const CellGroup &cells,
                              Scalar theta)
@@ -72,9 +83,7 @@ Equation<Scalar> cicsam::div(const VectorFiniteVolumeField &u,
 
             eqn.add(cell, donor, theta * (1. - b) * flux);
             eqn.add(cell, acceptor, theta * b * flux);
-
-            Scalar gammaF = (1. - b) * gamma(donor) + b * gamma(acceptor);
-            eqn.addSource(cell, (1. - theta) * flux * gammaF);
+            eqn.addSource(cell, (1. - theta) * flux * gammaF(nb.face()));
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
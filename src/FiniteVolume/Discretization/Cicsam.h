@@ -11,8 +11,25 @@ namespace cicsam
                                  Scalar timeStep,
                                  Scalar k = 1.);
 
+    //- Fills reusable beta and face volume fraction buffers in a single pass over the faces
+    void beta(const VectorFiniteVolumeField &u,
+              const VectorFiniteVolumeField &gradGamma,
+              const ScalarFiniteVolumeField &gamma,
+              Scalar timeStep,
+              ScalarFiniteVolumeField &beta,
+              ScalarFiniteVolumeField &gammaF,
+              Scalar k = 1.);
+
+    Equation<Scalar> div(const VectorFiniteVolumeField &u,
+                         const ScalarFiniteVolumeField &beta,
+                         ScalarFiniteVolumeField &gamma,
+                         const CellGroup &cells,
+                         Scalar theta);
+
+    //- Assembly with the explicit face volume fractions already computed by the face kernel
     Equation<Scalar> div(const VectorFiniteVolumeField &u,
                          const ScalarFiniteVolumeField &beta,
+                         const ScalarFiniteVolumeField &gammaF,
                          ScalarFiniteVolumeField &gamma,
                          const CellGroup &cells,
                          Scalar theta);
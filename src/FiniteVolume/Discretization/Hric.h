@@ -10,6 +10,13 @@ namespace hric
                                  const ScalarFiniteVolumeField &gamma,
                                  Scalar timeStep);
 
+    void beta(const VectorFiniteVolumeField &u,
+              const VectorFiniteVolumeField &gradGamma,
+              const ScalarFiniteVolumeField &gamma,
+              Scalar timeStep,
+              ScalarFiniteVolumeField &beta,
+              ScalarFiniteVolumeField &gammaF);
+
     Equation<Scalar> div(const VectorFiniteVolumeField &u,
                          const ScalarFiniteVolumeField& beta,
                          ScalarFiniteVolumeField &gamma,
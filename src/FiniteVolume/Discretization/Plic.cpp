@@ -1,7 +1,275 @@
+#include <algorithm>
+
 #include "Plic.h"
-#include "ScalarGradient.h"
 #include "Algorithm.h"
 
-namespace plic {
+namespace
+{
+    typedef std::vector<Point2D> Vertices;
+
+    //- Volume fractions closer than this to 0 or 1 are treated as a single phase
+    const Scalar eps = 1e-8;
+
+    Vertices vertices(const Polygon &pgn)
+    {
+        //- Polygon rings are closed, the last vertex repeats the first
+        return Vertices(pgn.vertices().begin(), pgn.vertices().end() - 1);
+    }
+
+    Scalar area(const Vertices &verts)
+    {
+        Scalar a = 0.;
+        for (Label i = 0, n = verts.size(); i < n; ++i)
+            a += cross(verts[i], verts[(i + 1) % n]);
+
+        return std::abs(a) / 2.;
+    }
+
+    //- Part of a convex polygon where dot(x, m) <= c
+    Vertices clip(const Vertices &verts, const Vector2D &m, Scalar c)
+    {
+        Vertices result;
+        result.reserve(verts.size() + 1);
+
+        for (Label i = 0, n = verts.size(); i < n; ++i)
+        {
+            const Point2D &a = verts[i];
+            const Point2D &b = verts[(i + 1) % n];
+            Scalar da = dot(a, m) - c, db = dot(b, m) - c;
+
+            if (da <= 0.)
+                result.push_back(a);
+
+            if ((da < 0. && db > 0.) || (da > 0. && db < 0.))
+                result.push_back(a + da / (da - db) * (b - a));
+        }
+
+        return result;
+    }
+
+    //- Part of a polygon inside a convex, counter-clockwise cell
+    Vertices clip(Vertices verts, const Vertices &cell)
+    {
+        for (Label i = 0, n = cell.size(); i < n && !verts.empty(); ++i)
+        {
+            Vector2D e = cell[(i + 1) % n] - cell[i];
+            Vector2D outwardNorm(e.y, -e.x);
+            verts = clip(verts, outwardNorm, dot(cell[i], outwardNorm));
+        }
+
+        return verts;
+    }
+
+    //- Constant c of the line dot(x, m) = c that cuts the fraction gamma from a convex polygon. The cut area is
+    //- piecewise quadratic in c with breaks at the vertices, so it is inverted exactly on the bracketing piece
+    Scalar lineConstant(const Vertices &verts, Scalar gamma, const Vector2D &m)
+    {
+        std::vector<Scalar> s(verts.size());
+        std::transform(verts.begin(), verts.end(), s.begin(), [&m](const Point2D &vtx) { return dot(vtx, m); });
+        std::sort(s.begin(), s.end());
+
+        if (gamma <= 0.)
+            return s.front();
+        else if (gamma >= 1.)
+            return s.back();
+
+        Scalar target = gamma * area(verts);
+        Scalar sLo = s.front(), aLo = 0.;
+
+        for (Label k = 1; k < s.size(); ++k)
+        {
+            Scalar aHi = k == s.size() - 1 ? area(verts) : area(clip(verts, m, s[k]));
+
+            if (aHi >= target)
+            {
+                Scalar aMid = area(clip(verts, m, (sLo + s[k]) / 2.));
+                Scalar b = 4. * (aMid - aLo) - (aHi - aLo);
+                Scalar a = aHi - aLo - b;
+                Scalar q = target - aLo;
+                Scalar den = b + std::sqrt(std::max(b * b + 4. * a * q, 0.));
+                Scalar t = den > 0. ? clamp(2. * q / den, 0., 1.) : 0.;
+
+                return sLo + t * (s[k] - sLo);
+            }
+
+            sLo = s[k];
+            aLo = aHi;
+        }
+
+        return s.back();
+    }
+}
+
+Polygon plic::interfacePolygon(const Cell &cell, Scalar gamma, const Vector2D &m)
+{
+    Vertices verts = vertices(cell.shape());
+    Vertices pgn = clip(verts, m, lineConstant(verts, gamma, m));
+
+    return pgn.size() < 3 ? Polygon() : Polygon(pgn.begin(), pgn.end());
+}
+
+ScalarFiniteVolumeField plic::fluxFractions(const VectorFiniteVolumeField &u,
+                                            const VectorFiniteVolumeField &gradGamma,
+                                            const ScalarFiniteVolumeField &gamma,
+                                            Scalar timeStep)
+{
+    const FiniteVolumeGrid2D &grid = gamma.grid();
+    ScalarFiniteVolumeField fraction(gamma.gridPtr(), "fraction");
+
+    //- Interfaces are reconstructed at most once per cell, and only in mixed cells
+    std::vector<Scalar> c(grid.cells().size());
+    std::vector<bool> reconstructed(grid.cells().size(), false);
+
+    auto donorFraction = [&](const Cell &donor, const Face &face) {
+        Scalar g = gamma(donor);
+        Vector2D m = -gradGamma(donor);
+
+        if (g <= eps)
+            return 0.;
+        else if (g >= 1. - eps)
+            return 1.;
+        else if (m.magSqr() == 0.)
+            return g;
+
+        m = m.unitVec();
+        Vertices cell = vertices(donor.shape());
+
+        if (!reconstructed[donor.id()])
+        {
+            c[donor.id()] = lineConstant(cell, g, m);
+            reconstructed[donor.id()] = true;
+        }
+
+        //- Region swept across the face during the time step, the part outside the donor is not known here
+        Vector2D d = u(face) * timeStep;
+        Vertices swept = clip({face.lNode(), face.rNode(), face.rNode() - d, face.lNode() - d}, cell);
+
+        Scalar total = area(swept);
+        return total > 0. ? clamp(area(clip(swept, m, c[donor.id()])) / total, 0., 1.) : g;
+    };
+
+    for (const Face &face: grid.interiorFaces())
+    {
+        Scalar flux = dot(u(face), face.outwardNorm(face.lCell().centroid()));
+        fraction(face) = donorFraction(flux >= 0. ? face.lCell() : face.rCell(), face);
+    }
+
+    for (const Face &face: grid.boundaryFaces())
+    {
+        Scalar flux = dot(u(face), face.outwardNorm(face.lCell().centroid()));
+        fraction(face) = flux > 0. ? donorFraction(face.lCell(), face) : clamp(gamma(face), 0., 1.);
+    }
+
+    return fraction;
+}
+
+Scalar plic::maxInterfaceCourantNumber(const VectorFiniteVolumeField &u,
+                                       const ScalarFiniteVolumeField &gamma,
+                                       Scalar timeStep,
+                                       const CellGroup &cells)
+{
+    Scalar maxCo = 0.;
+
+    for (const Cell &cell: cells)
+    {
+        if (gamma(cell) <= eps || gamma(cell) >= 1. - eps)
+            continue;
+
+        Scalar outflow = 0.;
+
+        for (const InteriorLink &nb: cell.neighbours())
+            outflow += std::max(dot(u(nb.face()), nb.outwardNorm()), 0.);
+
+        for (const BoundaryLink &bd: cell.boundaries())
+            outflow += std::max(dot(u(bd.face()), bd.outwardNorm()), 0.);
+
+        maxCo = std::max(outflow * timeStep / cell.volume(), maxCo);
+    }
+
+    return gamma.grid().comm().max(maxCo);
+}
+
+ScalarFiniteVolumeField plic::advect(const VectorFiniteVolumeField &u,
+                                     const VectorFiniteVolumeField &gradGamma,
+                                     ScalarFiniteVolumeField &gamma,
+                                     Scalar timeStep,
+                                     const CellGroup &cells)
+{
+    const FiniteVolumeGrid2D &grid = gamma.grid();
+
+    Scalar co = maxInterfaceCourantNumber(u, gamma, timeStep, cells);
+
+    if (co > courantLimit)
+        throw Exception("plic", "advect", "interface Courant number " + std::to_string(co)
+                                          + " exceeds the limit of 0.5. Reduce the time step or sub-cycle the volume fraction.");
+    ScalarFiniteVolumeField fraction = fluxFractions(u, gradGamma, gamma, timeStep);
+
+    //- Each donor cell may not lose more of either phase than it holds. Outflows are scaled down if too much of the
+    //- gamma = 1 phase leaves, and blended towards it if too much of the other phase leaves
+    std::vector<Scalar> limits(2 * grid.cells().size(), 0.);
+    Scalar *scale = limits.data(), *blend = limits.data() + grid.cells().size();
+
+    for (const Cell &cell: grid.localActiveCells())
+    {
+        Scalar totalOut = 0., phaseOut = 0.;
+
+        for (const InteriorLink &nb: cell.neighbours())
+        {
+            Scalar flux = dot(u(nb.face()), nb.outwardNorm()) * timeStep;
+
+            if (flux > 0.)
+            {
+                totalOut += flux;
+                phaseOut += fraction(nb.face()) * flux;
+            }
+        }
+
+        for (const BoundaryLink &bd: cell.boundaries())
+        {
+            Scalar flux = dot(u(bd.face()), bd.outwardNorm()) * timeStep;
+
+            if (flux > 0.)
+            {
+                totalOut += flux;
+                phaseOut += fraction(bd.face()) * flux;
+            }
+        }
+
+        Scalar g = clamp(gamma(cell), 0., 1.);
+        Scalar upper = g * cell.volume();
+        Scalar lower = std::max(totalOut - (1. - g) * cell.volume(), 0.);
+
+        scale[cell.id()] = phaseOut > upper ? upper / phaseOut : 1.;
+        blend[cell.id()] = phaseOut < lower ? (lower - phaseOut) / (totalOut - phaseOut) : 0.;
+    }
+
+    grid.sendMessages(limits, 2);
+
+    auto limit = [&fraction, scale, blend](const Face &face, const Cell &donor) {
+        Scalar f = scale[donor.id()] * fraction(face);
+        fraction(face) = f + (1. - f) * blend[donor.id()];
+    };
+
+    for (const Face &face: grid.interiorFaces())
+        limit(face, dot(u(face), face.outwardNorm(face.lCell().centroid())) >= 0. ? face.lCell() : face.rCell());
+
+    for (const Face &face: grid.boundaryFaces())
+        if (dot(u(face), face.outwardNorm(face.lCell().centroid())) > 0.)
+            limit(face, face.lCell());
+
+    //- Explicit update, the final clip only removes round-off and divergence errors
+    for (const Cell &cell: cells)
+    {
+        Scalar phaseOut = 0.;
+
+        for (const InteriorLink &nb: cell.neighbours())
+            phaseOut += dot(u(nb.face()), nb.outwardNorm()) * fraction(nb.face());
+
+        for (const BoundaryLink &bd: cell.boundaries())
+            phaseOut += dot(u(bd.face()), bd.outwardNorm()) * fraction(bd.face());
+
+        gamma(cell) = clamp(gamma(cell) - timeStep * phaseOut / cell.volume(), 0., 1.);
+    }
 
+    return fraction;
 }
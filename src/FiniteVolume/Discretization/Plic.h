@@ -1,22 +1,39 @@
 #ifndef PLIC_H
 #define PLIC_H
 
-#include "Equation.h"
+#include "ScalarFiniteVolumeField.h"
+#include "VectorFiniteVolumeField.h"
 
 namespace plic {
 
-    Equation<Scalar> div(const VectorFiniteVolumeField& u,
-                         const VectorFiniteVolumeField& gradGamma,
-                         ScalarFiniteVolumeField& gamma,
-                         Scalar timeStep);
+    //- Part of a cell occupied by the gamma = 1 phase, bounded by a line with normal m pointing out of the phase
+    Polygon interfacePolygon(const Cell &cell, Scalar gamma, const Vector2D &m);
 
-/*
-Equation<ScalarFiniteVolumeField> div(const VectorFiniteVolumeField &u, const VectorFiniteVolumeField& gradGamma, ScalarFiniteVolumeField &field, Scalar timeStep,
-                                      std::vector<Polygon>& plicPolygons);
+    //- Fraction of the volume crossing each face during a time step that belongs to the gamma = 1 phase, found by
+    //- clipping the swept face region against the reconstructed interface of the upwind cell
+    ScalarFiniteVolumeField fluxFractions(const VectorFiniteVolumeField &u,
+                                          const VectorFiniteVolumeField &gradGamma,
+                                          const ScalarFiniteVolumeField &gamma,
+                                          Scalar timeStep);
 
-Polygon computeInterfacePolygon(const Cell& cell, Scalar &gamma, const Vector2D& normal);
-Polygon computeFluxPolygon(const BoundaryLink &link, const Vector2D& uf, Scalar timeStep, int componentNo);
-*/
+    //- Beyond this interface Courant number the swept regions of neighbouring faces overlap and the fluxes are no
+    //- longer bounded
+    const Scalar courantLimit = 0.5;
+
+    //- Largest Courant number of the cells containing the interface
+    Scalar maxInterfaceCourantNumber(const VectorFiniteVolumeField &u,
+                                     const ScalarFiniteVolumeField &gamma,
+                                     Scalar timeStep,
+                                     const CellGroup &cells);
+
+    //- Explicit unsplit advection of gamma over the given cells, no linear system is solved. Returns the flux
+    //- fractions, which can be used to transport other phase quantities consistently. Throws if the interface
+    //- Courant number exceeds the stability limit of 0.5
+    ScalarFiniteVolumeField advect(const VectorFiniteVolumeField &u,
+                                   const VectorFiniteVolumeField &gradGamma,
+                                   ScalarFiniteVolumeField &gamma,
+                                   Scalar timeStep,
+                                   const CellGroup &cells);
 }
 
 #endif
@@ -0,0 +1,20 @@
+#include "Vof.h"
+
+void vof::outflowCourantNumbers(const VectorFiniteVolumeField &u, Scalar timeStep, std::vector<Scalar> &co)
+{
+    const FiniteVolumeGrid2D &grid = u.grid();
+    co.assign(grid.cells().size(), 0.);
+
+    for (const Face &face: grid.interiorFaces())
+    {
+        Scalar flux = dot(u(face), face.outwardNorm(face.lCell().centroid()));
+        co[face.lCell().id()] += std::max(flux, 0.);
+        co[face.rCell().id()] += std::max(-flux, 0.);
+    }
+
+    for (const Face &face: grid.boundaryFaces())
+        co[face.lCell().id()] += std::max(dot(u(face), face.outwardNorm(face.lCell().centroid())), 0.);
+
+    for (const Cell &cell: grid.cells())
+        co[cell.id()] *= timeStep / cell.volume();
+}
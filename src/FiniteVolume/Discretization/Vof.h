@@ -0,0 +1,28 @@
+#ifndef VOF_H
+#define VOF_H
+
+#include "ScalarFiniteVolumeField.h"
+#include "VectorFiniteVolumeField.h"
+
+//- Shared face kernel of the algebraic volume of fluid schemes (CICSAM, HRIC)
+namespace vof
+{
+    //- Outflow Courant number of every cell, accumulated face by face
+    void outflowCourantNumbers(const VectorFiniteVolumeField &u, Scalar timeStep, std::vector<Scalar> &co);
+
+    //- One pass over the interior faces, writing beta and the resulting face volume fraction into reusable buffers.
+    //- fcn maps the normalized donor value, the donor Courant number and the cosine of the angle between the
+    //- interface normal and the donor-acceptor direction to the normalized face value
+    template<class TFunc>
+    void faceKernel(const VectorFiniteVolumeField &u,
+                    const VectorFiniteVolumeField &gradGamma,
+                    const ScalarFiniteVolumeField &gamma,
+                    Scalar timeStep,
+                    ScalarFiniteVolumeField &beta,
+                    ScalarFiniteVolumeField &gammaF,
+                    const TFunc &fcn);
+}
+
+#include "Vof.tpp"
+
+#endif
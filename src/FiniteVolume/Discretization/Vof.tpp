@@ -0,0 +1,38 @@
+#include "Algorithm.h"
+
+template<class TFunc>
+void vof::faceKernel(const VectorFiniteVolumeField &u,
+                     const VectorFiniteVolumeField &gradGamma,
+                     const ScalarFiniteVolumeField &gamma,
+                     Scalar timeStep,
+                     ScalarFiniteVolumeField &beta,
+                     ScalarFiniteVolumeField &gammaF,
+                     const TFunc &fcn)
+{
+    std::vector<Scalar> coD;
+    outflowCourantNumbers(u, timeStep, coD);
+
+    for (const Face &face: gamma.grid().interiorFaces())
+    {
+        Vector2D sf = face.outwardNorm(face.lCell().centroid());
+        Scalar flux = dot(u(face), sf);
+        const Cell &donor = flux >= 0. ? face.lCell() : face.rCell();
+        const Cell &acceptor = flux >= 0. ? face.rCell() : face.lCell();
+        Vector2D rc = acceptor.centroid() - donor.centroid();
+
+        Scalar gammaD = clamp(gamma(donor), 0., 1.);
+        Scalar gammaA = clamp(gamma(acceptor), 0., 1.);
+        Scalar gammaU = clamp(gammaA - 2. * dot(rc, gradGamma(donor)), 0., 1.);
+        Scalar gammaDTilde = (gammaD - gammaU) / (gammaA - gammaU);
+
+        Scalar cosTheta = std::abs(dot(gradGamma(donor).unitVec(), rc.unitVec()));
+        Scalar gammaFTilde = fcn(gammaDTilde, coD[donor.id()], cosTheta);
+        Scalar betaFace = (gammaFTilde - gammaDTilde) / (1. - gammaDTilde);
+
+        //- If stencil cannot be computed, default to upwind
+        Scalar b = std::isnan(betaFace) ? 0. : clamp(betaFace, 0., 1.);
+
+        beta(face) = b;
+        gammaF(face) = (1. - b) * gamma(donor) + b * gamma(acceptor);
+    }
+}
@@ -75,6 +75,9 @@ public:
 
     Scalar minDiagonalDominance() const;
 
+    //- Global L2 norm of the residual A x + b for the current field values, before the system is solved
+    Scalar residualNorm() const;
+
     //- Operators
     Equation<T> &operator=(const Equation<T> &rhs);
 
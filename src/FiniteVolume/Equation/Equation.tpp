@@ -107,6 +107,8 @@ Equation<T> &Equation<T>::operator=(Equation<T> &&rhs)
 template<class T>
 Equation<T> &Equation<T>::operator+=(const Equation<T> &rhs)
 {
+    //- Rows are independent
+#pragma omp parallel for
     for (int i = 0; i < rhs.coeffs_.size(); ++i)
         for (const auto &entry: rhs.coeffs_[i])
             addValue(i, entry.first, entry.second);
@@ -119,9 +121,11 @@ Equation<T> &Equation<T>::operator+=(const Equation<T> &rhs)
 template<class T>
 Equation<T> &Equation<T>::operator-=(const Equation<T> &rhs)
 {
+    //- Rows are independent
+#pragma omp parallel for
     for (int i = 0; i < rhs.coeffs_.size(); ++i)
         for (const auto &entry: rhs.coeffs_[i])
-            add(i, entry.first, -entry.second);
+            addValue(i, entry.first, -entry.second);
 
     sources_ -= rhs.sources_;
 
@@ -172,6 +176,8 @@ Equation<T> &Equation<T>::operator==(Scalar rhs)
 template<class T>
 Equation<T> &Equation<T>::operator==(const Equation<T> &rhs)
 {
+    //- Rows are independent
+#pragma omp parallel for
     for (int i = 0; i < coeffs_.size(); ++i)
         for (const auto &entry: rhs.coeffs_[i])
             addValue(i, entry.first, -entry.second);
@@ -230,6 +236,7 @@ Scalar Equation<T>::solve()
     nLocalActiveCells_ = field_.grid().nLocalActiveCells();
     nGlobalActiveCells_ = field_.grid().nActiveCellsGlobal();
 
+    spSolver_->setTopologyVersion(field_.grid().topologyVersion());
     spSolver_->setRank(getRank());
     spSolver_->set(coeffs_);
     spSolver_->setRhs(-sources_);
@@ -1,10 +1,35 @@
 #ifndef TIME_DERIVATIVE_H
 #define TIME_DERIVATIVE_H
 
+#include <array>
+
 #include "Equation.h"
 
 namespace fv
 {
+    enum TimeScheme
+    {
+        EULER, BDF2
+    };
+
+    //- Weights of the new, current and previous values, scaled by the time step. Variable step BDF2 needs the
+    //- previous value in oldField(1), backward Euler is used until it is available
+    template<typename T>
+    std::array<Scalar, 3> ddtWeights(const FiniteVolumeField<T> &field, Scalar timeStep, TimeScheme scheme)
+    {
+        if (scheme == EULER || !field.hasOldField(1) || field.oldTimeStep(1) <= 0.)
+            return {1., -1., 0.};
+
+        Scalar w = timeStep / field.oldTimeStep(1);
+        return {(1. + 2. * w) / (1. + w), -(1. + w), w * w / (1. + w)};
+    }
+
+    //- BDF2 evaluates the spatial terms at the new time level, so Crank-Nicolson weighted terms become implicit
+    inline Scalar implicitWeight(TimeScheme scheme, Scalar theta)
+    {
+        return scheme == BDF2 && theta > 0. ? 1. : theta;
+    }
+
     template<typename T>
     Equation<T> ddt(Scalar rho, FiniteVolumeField<T>& field, Scalar timeStep, const CellGroup& cells)
     {
@@ -35,6 +60,26 @@ namespace fv
         return eqn;
     }
 
+    //- Local time steps, for pseudo-transient continuation to a steady state
+    template<typename T>
+    Equation<T> ddt(const ScalarFiniteVolumeField &rho,
+                    FiniteVolumeField<T> &field,
+                    const ScalarFiniteVolumeField &timeStep,
+                    const CellGroup &cells)
+    {
+        const ScalarFiniteVolumeField &rho0 = rho.oldField(0);
+
+        Equation<T> eqn(field);
+
+        for (const Cell &cell: cells)
+        {
+            eqn.add(cell, cell, rho(cell) * cell.volume() / timeStep(cell));
+            eqn.addSource(cell, -rho0(cell) * cell.volume() * field(cell) / timeStep(cell));
+        }
+
+        return eqn;
+    }
+
     template<typename T>
     Equation<T> ddt(FiniteVolumeField<T> &field, Scalar timeStep, const CellGroup& cells)
     {
@@ -49,6 +94,60 @@ namespace fv
         return eqn;
     }
 
+    template<typename T>
+    Equation<T> ddt(Scalar rho, FiniteVolumeField<T> &field, Scalar timeStep, const CellGroup &cells, TimeScheme scheme)
+    {
+        std::array<Scalar, 3> a = ddtWeights(field, timeStep, scheme);
+
+        if (a[2] == 0.)
+            return ddt(rho, field, timeStep, cells);
+
+        const FiniteVolumeField<T> &field1 = field.oldField(1);
+
+        Equation<T> eqn(field);
+
+        for (const Cell &cell: cells)
+        {
+            eqn.add(cell, cell, a[0] * rho * cell.volume() / timeStep);
+            eqn.addSource(cell, rho * cell.volume() * (a[1] * field(cell) + a[2] * field1(cell)) / timeStep);
+        }
+
+        return eqn;
+    }
+
+    template<typename T>
+    Equation<T> ddt(const ScalarFiniteVolumeField &rho,
+                    FiniteVolumeField<T> &field,
+                    Scalar timeStep,
+                    const CellGroup &cells,
+                    TimeScheme scheme)
+    {
+        std::array<Scalar, 3> a = ddtWeights(field, timeStep, scheme);
+
+        if (a[2] == 0. || !rho.hasOldField(1))
+            return ddt(rho, field, timeStep, cells);
+
+        const ScalarFiniteVolumeField &rho0 = rho.oldField(0), &rho1 = rho.oldField(1);
+        const FiniteVolumeField<T> &field1 = field.oldField(1);
+
+        Equation<T> eqn(field);
+
+        for (const Cell &cell: cells)
+        {
+            eqn.add(cell, cell, a[0] * rho(cell) * cell.volume() / timeStep);
+            eqn.addSource(cell, cell.volume() * (a[1] * rho0(cell) * field(cell) + a[2] * rho1(cell) * field1(cell))
+                                / timeStep);
+        }
+
+        return eqn;
+    }
+
+    template<typename T>
+    Equation<T> ddt(FiniteVolumeField<T> &field, Scalar timeStep, const CellGroup &cells, TimeScheme scheme)
+    {
+        return ddt(1., field, timeStep, cells, scheme);
+    }
+
     template <class T>
     Equation<T> ddt(Scalar rho, FiniteVolumeField<T>& field, Scalar timeStep)
     {
@@ -66,6 +165,18 @@ namespace fv
     {
         return ddt(field, timeStep, field.grid().cellZone("fluid"));
     }
+
+    template <class T>
+    Equation<T> ddt(const ScalarFiniteVolumeField& rho, FiniteVolumeField<T>& field, Scalar timeStep, TimeScheme scheme)
+    {
+        return ddt(rho, field, timeStep, field.grid().cellZone("fluid"), scheme);
+    }
+
+    template <class T>
+    Equation<T> ddt(FiniteVolumeField<T>& field, Scalar timeStep, TimeScheme scheme)
+    {
+        return ddt(field, timeStep, field.grid().cellZone("fluid"), scheme);
+    }
 }
 
 #endif
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "Equation.h"
 
 template<>
@@ -176,6 +178,58 @@ Equation<Vector2D> &Equation<Vector2D>::operator-=(const VectorFiniteVolumeField
     return *this;
 }
 
+template<>
+Scalar Equation<Vector2D>::residualNorm() const
+{
+    //- Local columns are contiguous and follow the row ordering, columns of buffer cells are looked up in a sorted list
+    std::vector<Scalar> x(2 * nLocalActiveCells_);
+    std::vector<std::pair<Index, Scalar>> bufferX;
+    Index start = 0;
+
+    for (const Cell &cell: field_.grid().globalActiveCells())
+        if (cell.index(0) != -1)
+        {
+            x[cell.index(0)] = field_(cell).x;
+            x[cell.index(0) + nLocalActiveCells_] = field_(cell).y;
+            start = cell.index(2) - cell.index(0);
+        }
+        else
+        {
+            bufferX.emplace_back(cell.index(2), field_(cell).x);
+            bufferX.emplace_back(cell.index(3), field_(cell).y);
+        }
+
+    std::sort(bufferX.begin(), bufferX.end());
+
+    auto value = [&](Index col) -> Scalar {
+        if (col >= start && col < start + 2 * (Index) nLocalActiveCells_)
+            return x[col - start];
+
+        auto it = std::lower_bound(bufferX.begin(), bufferX.end(), col,
+                                   [](const std::pair<Index, Scalar> &entry, Index c) { return entry.first < c; });
+
+        if (it == bufferX.end() || it->first != col)
+            throw Exception("Equation<Vector2D>", "residualNorm",
+                            "column " + std::to_string(col) + " is neither a local nor a buffer cell.");
+
+        return it->second;
+    };
+
+    Scalar sumSqr = 0.;
+
+    for (Index i = 0; i < coeffs_.size(); ++i)
+    {
+        Scalar r = sources_(i);
+
+        for (const auto &entry: coeffs_[i])
+            r += entry.second * value(entry.first);
+
+        sumSqr += r * r;
+    }
+
+    return std::sqrt(field_.grid().comm().sum(sumSqr));
+}
+
 //- Private
 template<>
 Size Equation<Vector2D>::getRank() const
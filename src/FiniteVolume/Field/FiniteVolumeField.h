@@ -3,6 +3,7 @@
 
 #include "Field.h"
 #include "FiniteVolumeGrid2D.h"
+#include "HaloExchange.h"
 #include "Input.h"
 #include "Vector.h"
 
@@ -41,32 +42,45 @@ public:
 
     void fillInterior(const T &val);
 
+    //- Loops are shared by the process thread team, fcn must not modify shared state
     template<class TFunc>
     void computeCells(const TFunc &fcn)
     {
-        for (const Cell &cell: grid().cells())
-            (*this)(cell) = fcn(cell);
+        const std::vector<Cell> &cells = grid().cells();
+
+#pragma omp parallel for
+        for (int i = 0; i < cells.size(); ++i)
+            (*this)(cells[i]) = fcn(cells[i]);
     }
 
     template<class TFunc>
     void computeFaces(const TFunc &fcn)
     {
-        for (const Face &face: grid().faces())
-            (*this)(face) = fcn(face);
+        const std::vector<Face> &faces = grid().faces();
+
+#pragma omp parallel for
+        for (int i = 0; i < faces.size(); ++i)
+            (*this)(faces[i]) = fcn(faces[i]);
     }
 
     template<class TFunc>
     void computeInteriorFaces(const TFunc &fcn)
     {
-        for (const Face &face: grid().interiorFaces())
-            (*this)(face) = fcn(face);
+        auto faces = grid().interiorFaces().begin();
+
+#pragma omp parallel for
+        for (int i = 0; i < grid().interiorFaces().size(); ++i)
+            (*this)(faces[i]) = fcn(faces[i]);
     }
 
     template<class TFunc>
     void computeBoundaryFaces(const TFunc &fcn)
     {
-        for (const Face &face: grid().boundaryFaces())
-            (*this)(face) = fcn(face);
+        auto faces = grid().boundaryFaces().begin();
+
+#pragma omp parallel for
+        for (int i = 0; i < grid().boundaryFaces().size(); ++i)
+            (*this)(faces[i]) = fcn(faces[i]);
     }
 
     void faceToCell(const FiniteVolumeField<Scalar> &cellWeight,
@@ -92,15 +106,30 @@ public:
 
     template<class TFunc>
     void interpolateFaces(const TFunc &alpha)
+    {
+        interpolateFaces(grid_->interiorFaces(), alpha);
+        setBoundaryFaces();
+    }
+
+    template<class TFunc>
+    void interpolateFaces(const FaceGroup &faces, const TFunc &alpha)
     {
         auto &self = *this;
 
-        for (const Face &face: grid_->interiorFaces())
+        for (const Face &face: faces)
         {
             Scalar g = alpha(face);
             self(face) = g * self(face.lCell()) + (1. - g) * self(face.rCell());
         }
+    }
 
+    //- Interpolate faces not adjacent to buffer zones while a started halo exchange of this field completes
+    template<class TFunc>
+    void interpolateFaces(HaloExchange &halo, const TFunc &alpha)
+    {
+        interpolateFaces(grid_->localInteriorFaces(), alpha);
+        halo.finish();
+        interpolateFaces(grid_->bufferFaces(), alpha);
         setBoundaryFaces();
     }
 
@@ -121,6 +150,23 @@ public:
         }
     }
 
+    void interpolateFaces(HaloExchange &halo, InterpolationType type = VOLUME)
+    {
+        switch (type)
+        {
+            case VOLUME:
+                interpolateFaces(halo, [](const Face &face) {
+                    return face.volumeWeight();
+                });
+                break;
+            case DISTANCE:
+                interpolateFaces(halo, [](const Face &face) {
+                    return face.distanceWeight();
+                });
+                break;
+        }
+    }
+
     void setBoundaryFaces();
 
     void setBoundaryFaces(BoundaryType bType, const std::function<T(const Face &face)> &fcn);
@@ -200,6 +246,9 @@ public:
     Scalar oldTimeStep(int i) const
     { return previousTimeSteps_[i]->first; }
 
+    bool hasOldField(int i) const
+    { return i < previousTimeSteps_.size() && previousTimeSteps_[i]; }
+
     const FiniteVolumeField &prevIteration() const
     { return *previousIteration_; }
 
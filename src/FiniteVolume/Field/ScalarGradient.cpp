@@ -13,106 +13,47 @@ ScalarGradient::ScalarGradient(const ScalarFiniteVolumeField& phi)
 
 void ScalarGradient::computeFaces()
 {
-    VectorFiniteVolumeField &gradPhi = *this;
-
-    for(const Face& face: grid_->interiorFaces())
-    {
-        Vector2D rc = face.rCell().centroid() - face.lCell().centroid();
-        gradPhi(face) = (phi_(face.rCell()) - phi_(face.lCell())) * rc / dot(rc, rc);
-    }
-
-    for(const Face& face: grid_->boundaryFaces())
-    {
-        Vector2D rf = face.centroid() - face.lCell().centroid();
-        gradPhi(face) = (phi_(face) - phi_(face.lCell())) * rf / dot(rf, rf);
-    }
+    computeInteriorFaces(grid_->interiorFaces());
+    computeBoundaryFaces();
 }
 
 void ScalarGradient::compute(const CellGroup& group, Method method) {
     computeFaces();
-    VectorFiniteVolumeField &gradPhi = *this;
 
-    std::fill(gradPhi.begin(), gradPhi.end(), Vector2D(0., 0.));
+    std::fill(begin(), end(), Vector2D(0., 0.));
 
-    switch (method)
-    {
-        case FACE_TO_CELL:
-            for (const Cell &cell: group)
-            {
-                Vector2D sum(0., 0.), tmp(0., 0.);
+    auto cells = group.begin();
 
-                for (const InteriorLink &nb: cell.neighbours()) {
-                    Vector2D sf = nb.outwardNorm().abs();
-                    tmp += pointwise(gradPhi(nb.face()), sf);
-                    sum += sf;
-                }
+#pragma omp parallel for
+    for (int i = 0; i < group.size(); ++i)
+        computeCell(cells[i], method);
+}
 
-                for (const InteriorLink &bd: cell.neighbours()) {
-                    Vector2D sf = bd.outwardNorm().abs();
-                    tmp += pointwise(gradPhi(bd.face()), sf);
-                    sum += sf;
-                }
+void ScalarGradient::compute(HaloExchange &halo, Method method)
+{
+    std::fill(begin(), end(), Vector2D(0., 0.));
 
-                gradPhi(cell) = Vector2D(tmp.x / sum.x, tmp.y / sum.y);
-            }
-            break;
-        case GREEN_GAUSS_CELL:
-            for(const Cell& cell: group)
-            {
-                for (const InteriorLink &nb: cell.neighbours())
-                {
-                    Scalar g = nb.distanceWeight();
-                    Scalar phiF = g * phi_(cell) + (1. - g) * phi_(nb.cell());
-                    gradPhi(cell) += phiF * nb.outwardNorm();
-                }
+    //- Cells independent of the buffer zones are computed while the exchange of phi completes
+    computeInteriorFaces(grid_->localInteriorFaces());
 
-                for (const BoundaryLink &bd: cell.boundaries())
-                    gradPhi(cell) += phi_(bd.face()) * bd.outwardNorm();
+    const CellGroup &interiorCells = grid_->localInteriorCells();
+    auto cells = interiorCells.begin();
 
-                gradPhi(cell) /= cell.volume();
-            }
-            break;
-        case GREEN_GAUSS_NODE:
-            for(const Cell& cell: group)
-            {
-                for (const InteriorLink &nb: cell.neighbours())
-                {
-                    auto lNodeWeights = nb.face().lNode().distanceWeights();
-                    auto rNodeWeights = nb.face().rNode().distanceWeights();
-                    Scalar phiLN = 0, phiRN = 0;
-                    int i = 0;
-                    for(const Cell& cell: nb.face().lNode().cells())
-                        phiLN += lNodeWeights[i++] * phi_(cell);
-
-                    i = 0;
-                    for(const Cell& cell: nb.face().rNode().cells())
-                        phiRN += rNodeWeights[i++] * phi_(cell);
-
-                    Scalar phiF = (phiLN + phiRN) / 2.;
-                    gradPhi(cell) += phiF * nb.outwardNorm();
-                }
+#pragma omp parallel for
+    for (int i = 0; i < interiorCells.size(); ++i)
+        computeCell(cells[i], method);
 
-                for (const BoundaryLink &bd: cell.boundaries())
-                {
-                    auto lNodeWeights = bd.face().lNode().distanceWeights();
-                    auto rNodeWeights = bd.face().rNode().distanceWeights();
-                    Scalar phiLN = 0, phiRN = 0;
-                    int i = 0;
-                    for(const Cell& cell: bd.face().lNode().cells())
-                        phiLN += lNodeWeights[i++] * phi_(cell);
-
-                    i = 0;
-                    for(const Cell& cell: bd.face().rNode().cells())
-                        phiRN += rNodeWeights[i++] * phi_(cell);
-
-                    Scalar phiF = (phiLN + phiRN) / 2.;
-                    gradPhi(cell) += phiF * bd.outwardNorm();
-                }
+    halo.finish();
 
-                gradPhi(cell) /= cell.volume();
-            }
-            break;
-    }
+    computeInteriorFaces(grid_->bufferFaces());
+    computeBoundaryFaces();
+
+    const CellGroup &boundaryCells = grid_->localBoundaryCells();
+    cells = boundaryCells.begin();
+
+#pragma omp parallel for
+    for (int i = 0; i < boundaryCells.size(); ++i)
+        computeCell(cells[i], method);
 }
 
 void ScalarGradient::computeAxisymmetric(const CellGroup &cells, Method method)
@@ -187,4 +128,111 @@ void ScalarGradient::compute(const ScalarFiniteVolumeField& weight)
 
         gradPhi(cell) = weight(cell) * Vector2D(tmp.x / sum.x, tmp.y / sum.y);
     }
-}
\ No newline at end of file
+}
+//- Private methods
+
+void ScalarGradient::computeInteriorFaces(const FaceGroup &faces)
+{
+    VectorFiniteVolumeField &gradPhi = *this;
+    auto itr = faces.begin();
+
+#pragma omp parallel for
+    for(int i = 0; i < faces.size(); ++i)
+    {
+        const Face &face = itr[i];
+        Vector2D rc = face.rCell().centroid() - face.lCell().centroid();
+        gradPhi(face) = (phi_(face.rCell()) - phi_(face.lCell())) * rc / dot(rc, rc);
+    }
+}
+
+void ScalarGradient::computeBoundaryFaces()
+{
+    VectorFiniteVolumeField &gradPhi = *this;
+    auto itr = grid_->boundaryFaces().begin();
+
+#pragma omp parallel for
+    for(int i = 0; i < grid_->boundaryFaces().size(); ++i)
+    {
+        const Face &face = itr[i];
+        Vector2D rf = face.centroid() - face.lCell().centroid();
+        gradPhi(face) = (phi_(face) - phi_(face.lCell())) * rf / dot(rf, rf);
+    }
+}
+
+void ScalarGradient::computeCell(const Cell &cell, Method method)
+{
+    VectorFiniteVolumeField &gradPhi = *this;
+
+    switch (method)
+    {
+        case FACE_TO_CELL:
+        {
+            Vector2D sum(0., 0.), tmp(0., 0.);
+
+            for (const InteriorLink &nb: cell.neighbours()) {
+                Vector2D sf = nb.outwardNorm().abs();
+                tmp += pointwise(gradPhi(nb.face()), sf);
+                sum += sf;
+            }
+
+            for (const InteriorLink &bd: cell.neighbours()) {
+                Vector2D sf = bd.outwardNorm().abs();
+                tmp += pointwise(gradPhi(bd.face()), sf);
+                sum += sf;
+            }
+
+            gradPhi(cell) = Vector2D(tmp.x / sum.x, tmp.y / sum.y);
+        }
+            break;
+        case GREEN_GAUSS_CELL:
+            for (const InteriorLink &nb: cell.neighbours())
+            {
+                Scalar g = nb.distanceWeight();
+                Scalar phiF = g * phi_(cell) + (1. - g) * phi_(nb.cell());
+                gradPhi(cell) += phiF * nb.outwardNorm();
+            }
+
+            for (const BoundaryLink &bd: cell.boundaries())
+                gradPhi(cell) += phi_(bd.face()) * bd.outwardNorm();
+
+            gradPhi(cell) /= cell.volume();
+            break;
+        case GREEN_GAUSS_NODE:
+            for (const InteriorLink &nb: cell.neighbours())
+            {
+                auto lNodeWeights = nb.face().lNode().distanceWeights();
+                auto rNodeWeights = nb.face().rNode().distanceWeights();
+                Scalar phiLN = 0, phiRN = 0;
+                int i = 0;
+                for(const Cell& cell: nb.face().lNode().cells())
+                    phiLN += lNodeWeights[i++] * phi_(cell);
+
+                i = 0;
+                for(const Cell& cell: nb.face().rNode().cells())
+                    phiRN += rNodeWeights[i++] * phi_(cell);
+
+                Scalar phiF = (phiLN + phiRN) / 2.;
+                gradPhi(cell) += phiF * nb.outwardNorm();
+            }
+
+            for (const BoundaryLink &bd: cell.boundaries())
+            {
+                auto lNodeWeights = bd.face().lNode().distanceWeights();
+                auto rNodeWeights = bd.face().rNode().distanceWeights();
+                Scalar phiLN = 0, phiRN = 0;
+                int i = 0;
+                for(const Cell& cell: bd.face().lNode().cells())
+                    phiLN += lNodeWeights[i++] * phi_(cell);
+
+                i = 0;
+                for(const Cell& cell: bd.face().rNode().cells())
+                    phiRN += rNodeWeights[i++] * phi_(cell);
+
+                Scalar phiF = (phiLN + phiRN) / 2.;
+                gradPhi(cell) += phiF * bd.outwardNorm();
+            }
+
+            gradPhi(cell) /= cell.volume();
+            break;
+    }
+}
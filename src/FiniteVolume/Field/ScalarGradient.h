@@ -15,11 +15,22 @@ public:
 
     void compute(const CellGroup& cells, Method method = FACE_TO_CELL);
 
+    //- Computes the gradient in the local active cells, overlapped with a started halo exchange of phi. Boundary
+    //- faces of phi owned by buffer cells are not needed, they are only replicas of the owning process
+    void compute(HaloExchange& halo, Method method = FACE_TO_CELL);
+
     void computeAxisymmetric(const CellGroup& cells, Method method = FACE_TO_CELL);
 
     void compute(const ScalarFiniteVolumeField& weight);
 
 private:
+
+    void computeInteriorFaces(const FaceGroup& faces);
+
+    void computeBoundaryFaces();
+
+    void computeCell(const Cell& cell, Method method);
+
     const ScalarFiniteVolumeField& phi_;
 };
 
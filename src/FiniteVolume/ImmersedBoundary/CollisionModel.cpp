@@ -1,5 +1,7 @@
 #include <algorithm>
 
+#include <boost/geometry/index/rtree.hpp>
+
 #include "CollisionModel.h"
 
 CollisionModel::CollisionModel(Scalar eps, Scalar range)
@@ -8,6 +10,32 @@ CollisionModel::CollisionModel(Scalar eps, Scalar range)
     range_ = range;
 }
 
+std::vector<std::pair<Label, Label>> CollisionModel::candidatePairs(const std::vector<BoundingBox> &boxes) const
+{
+    namespace bgi = boost::geometry::index;
+
+    std::vector<std::pair<BoundingBox, Label>> values;
+    values.reserve(boxes.size());
+
+    for (Label i = 0; i < boxes.size(); ++i)
+        values.push_back(std::make_pair(boxes[i], i));
+
+    bgi::rtree<std::pair<BoundingBox, Label>, bgi::quadratic<16>> tree(values.begin(), values.end());
+
+    std::vector<std::pair<Label, Label>> pairs;
+    for (Label p = 0; p < boxes.size(); ++p)
+    {
+        BoundingBox box(boxes[p].min_corner() - Vector2D(range_, range_),
+                        boxes[p].max_corner() + Vector2D(range_, range_));
+
+        for (auto it = tree.qbegin(bgi::intersects(box)); it != tree.qend(); ++it)
+            if (it->second > p)
+                pairs.push_back(std::make_pair(p, it->second));
+    }
+
+    return pairs;
+}
+
 Vector2D CollisionModel::force(const ImmersedBoundaryObject &ibObjP, const ImmersedBoundaryObject &ibObjQ) const
 {
     if (ibObjP.shape().type() == Shape2D::CIRCLE && ibObjQ.shape().type() == Shape2D::CIRCLE)
@@ -23,9 +51,16 @@ Vector2D CollisionModel::force(const ImmersedBoundaryObject &ibObjP, const Immer
 
         return d > r1 + r2 + range_ ? Vector2D(0., 0.) : (xp - xq) / eps_ * pow(r1 + r2 + range_ - d, 2);
     }
+
+    return Vector2D(0., 0.);
 }
 
 Vector2D CollisionModel::force(const ImmersedBoundaryObject &ibObj, const FiniteVolumeGrid2D &grid) const
+{
+    return grid.comm().sum(localForce(ibObj, grid));
+}
+
+Vector2D CollisionModel::localForce(const ImmersedBoundaryObject &ibObj, const FiniteVolumeGrid2D &grid) const
 {
     Vector2D fc = Vector2D(0., 0.);
 
@@ -45,5 +80,5 @@ Vector2D CollisionModel::force(const ImmersedBoundaryObject &ibObj, const Finite
             }
     }
 
-    return grid.comm().sum(fc);
-}
\ No newline at end of file
+    return fc;
+}
@@ -7,12 +7,24 @@ class CollisionModel
 {
 public:
 
+    typedef boost::geometry::model::box<Point2D> BoundingBox;
+
     CollisionModel(Scalar eps, Scalar range = 0.);
 
+    Scalar range() const
+    { return range_; }
+
+    //- Broad phase, returns the pairs (p, q), p < q, whose bounding boxes overlap once grown by the range
+    std::vector<std::pair<Label, Label>> candidatePairs(const std::vector<BoundingBox> &boxes) const;
+
+    //- Force on P due to Q. The force on Q due to P is equal and opposite
     virtual Vector2D force(const ImmersedBoundaryObject& ibObjP, const ImmersedBoundaryObject& ibObjQ) const;
 
     virtual Vector2D force(const ImmersedBoundaryObject& ibObj, const FiniteVolumeGrid2D& grid) const;
 
+    //- Wall force from the boundary patches on this proc only
+    virtual Vector2D localForce(const ImmersedBoundaryObject& ibObj, const FiniteVolumeGrid2D& grid) const;
+
 private:
 
     Scalar eps_, range_;
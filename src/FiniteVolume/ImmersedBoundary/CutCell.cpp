@@ -15,7 +15,7 @@ CutCell::CutCell(const Cell &cell, const ImmersedBoundaryObject &ibObj)
     for (; vtxB != cellShape.vertices().end(); ++vtxA, ++vtxB)
     {
         LineSegment2D edge(*vtxA, *vtxB);
-        bool inSolid = ibObj.shape().isInside(edge.ptA());
+        bool inSolid = ibObj.isInIb(edge.ptA());
 
         if (inSolid)
             solidVerts.push_back(edge.ptA());
@@ -43,11 +43,18 @@ void GhostCellImmersedBoundaryObject::updateCells()
         return false;
     };
 
-    for (const Cell &cell: cells_)
-        if (isIbCell(cell))
-            ibCells_.add(cell);
+    auto cells = cells_.begin();
+    std::vector<char> ibCellFlags(cells_.size());
+
+#pragma omp parallel for
+    for (int i = 0; i < cells_.size(); ++i)
+        ibCellFlags[i] = isIbCell(cells[i]);
+
+    for (int i = 0; i < cells_.size(); ++i)
+        if (ibCellFlags[i])
+            ibCells_.add(cells[i]);
         else
-            solidCells_.add(cell);
+            solidCells_.add(cells[i]);
 
     constructStencils();
 }
@@ -186,8 +193,8 @@ Equation<Scalar> GhostCellImmersedBoundaryObject::contactLineBcs(ScalarFiniteVol
         Ray2D r1 = Ray2D(st.cell().centroid(), wn.rotate(M_PI_2 - theta));
         Ray2D r2 = Ray2D(st.cell().centroid(), wn.rotate(theta - M_PI_2));
 
-        GhostCellStencil m1(st.cell(), shape().intersections(r1)[0], r1.r(), grid_);
-        GhostCellStencil m2(st.cell(), shape().intersections(r2)[0], r2.r(), grid_);
+        GhostCellStencil m1(st.cell(), intersection(r1), r1.r(), grid_);
+        GhostCellStencil m2(st.cell(), intersection(r2), r2.r(), grid_);
 
         if (theta < M_PI_2)
         {
@@ -215,7 +222,24 @@ Equation<Scalar> GhostCellImmersedBoundaryObject::contactLineBcs(ScalarFiniteVol
 
 void GhostCellImmersedBoundaryObject::constructStencils()
 {
+    //- Stencils are cached by cell id, and only rebuilt where the boundary point moved
+    std::unordered_map<Label, GhostCellStencil> cache;
+    for (GhostCellStencil &st: stencils_)
+        cache.insert(std::make_pair(st.cell().id(), std::move(st)));
+
     stencils_.clear();
+    stencils_.reserve(ibCells_.size());
+
     for (const Cell &cell: ibCells_)
-        stencils_.push_back(GhostCellStencil(cell, *this, grid_));
+    {
+        auto it = cache.find(cell.id());
+
+        if (it == cache.end())
+            stencils_.push_back(GhostCellStencil(cell, *this, grid_));
+        else
+        {
+            it->second.update(*this, grid_);
+            stencils_.push_back(std::move(it->second));
+        }
+    }
 }
\ No newline at end of file
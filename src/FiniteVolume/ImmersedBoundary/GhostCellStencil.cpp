@@ -7,56 +7,9 @@ GhostCellStencil::GhostCellStencil(const Cell &cell,
         :
         ImmersedBoundaryStencil(cell)
 {
-    bp_ = ibObj.shape().nearestIntersect(cell.centroid());
-    ip_ = 2. * bp_ - cell.centroid();
-    cells_ = grid.findNearestNode(ip_).cells();
-
-    if (cells_.size() != 4)
-        throw Exception("GhostCellStencil", "GhostCellStencil", "number of image point cells must be 4.");
-
-    Point2D x1 = cells_[0].get().centroid();
-    Point2D x2 = cells_[1].get().centroid();
-    Point2D x3 = cells_[2].get().centroid();
-    Point2D x4 = cells_[3].get().centroid();
-
-    bool ghostCellInStencil = false;
-    for (const Cell &cell: cells_)
-        if (cell_.get().id() == cell.id())
-        {
-            ghostCellInStencil = true;
-            break;
-        }
-
-    A_ = inverse<4, 4>(
-            {
-                    x1.x * x1.y, x1.x, x1.y, 1.,
-                    x2.x * x2.y, x2.x, x2.y, 1.,
-                    x3.x * x3.y, x3.x, x3.y, 1.,
-                    x4.x * x4.y, x4.x, x4.y, 1.,
-            });
-
-    if (ghostCellInStencil)
-    {
-        Vector2D n = ibObj.nearestEdgeNormal(bp_).unitVec();
-        auto xd = StaticMatrix<1, 4>({bp_.x * bp_.y, bp_.x, bp_.y, 1.}) * A_;
-        auto xn = StaticMatrix<1, 4>({{bp_.y * n.x + bp_.x * n.y, n.x, n.y, 0.}}) * A_;
-
-        dirichletCoeffs_.insert(dirichletCoeffs_.end(), xd.data(), xd.data() + 4);
-        neumannCoeffs_.insert(neumannCoeffs_.end(), xn.data(), xn.data() + 4);
-    }
-    else
-    {
-        cells_.push_back(cell_);
-
-        auto xd = StaticMatrix<1, 4>({ip_.x * ip_.y, ip_.x, ip_.y, 1.}) * A_ / 2.;
-        auto xn = StaticMatrix<1, 4>({ip_.x * ip_.y, ip_.x, ip_.y, 1.}) * A_ / -length();
-
-        dirichletCoeffs_.insert(dirichletCoeffs_.end(), xd.data(), xd.data() + 4);
-        dirichletCoeffs_.push_back(1. / 2.);
-
-        neumannCoeffs_.insert(neumannCoeffs_.end(), xn.data(), xn.data() + 4);
-        neumannCoeffs_.push_back(1. / length());
-    }
+    bp_ = ibObj.nearestIntersect(cell.centroid());
+    initImagePoint(grid);
+    computeCoeffs(ibObj);
 }
 
 GhostCellStencil::GhostCellStencil(const Cell &cell,
@@ -67,34 +20,9 @@ GhostCellStencil::GhostCellStencil(const Cell &cell,
         ImmersedBoundaryStencil(cell)
 {
     bp_ = bp;
-    ip_ = 2 * bp - cell.centroid();
-    cells_ = grid.findNearestNode(ip_).cells();
-
-    if (cells_.size() != 4)
-        throw Exception("GhostCellStencil", "GhostCellStencil", "number of image point cells must be 4.");
-
-    Point2D x1 = cells_[0].get().centroid();
-    Point2D x2 = cells_[1].get().centroid();
-    Point2D x3 = cells_[2].get().centroid();
-    Point2D x4 = cells_[3].get().centroid();
-
-    bool ghostCellInStencil = false;
-    for (const Cell &cell: cells_)
-        if (cell_.get().id() == cell.id())
-        {
-            ghostCellInStencil = true;
-            break;
-        }
-
-    A_ = inverse<4, 4>(
-            {
-                    x1.x * x1.y, x1.x, x1.y, 1.,
-                    x2.x * x2.y, x2.x, x2.y, 1.,
-                    x3.x * x3.y, x3.x, x3.y, 1.,
-                    x4.x * x4.y, x4.x, x4.y, 1.,
-            });
+    initImagePoint(grid);
 
-    if (ghostCellInStencil)
+    if (ghostCellInStencil())
     {
         Vector2D n = cl.unitVec();
         auto xn = StaticMatrix<1, 4>({bp_.y * n.x + bp_.x * n.y, n.x, n.y, 0.}) * A_;
@@ -103,39 +31,39 @@ GhostCellStencil::GhostCellStencil(const Cell &cell,
     else
     {
         cells_.push_back(cell_);
-        auto xn = StaticMatrix<1, 4>({ip_.x * ip_.y, ip_.x, ip_.y, 1.}) * A_;
-        neumannCoeffs_.insert(neumannCoeffs_.end(), xn.data(), xn.data() + 4);
+        neumannCoeffs_.insert(neumannCoeffs_.end(), ipWeights_.data(), ipWeights_.data() + 4);
         neumannCoeffs_.push_back(-1.);
     }
 }
 
-Scalar GhostCellStencil::ipValue(const ScalarFiniteVolumeField &field) const
+bool GhostCellStencil::update(const GhostCellImmersedBoundaryObject &ibObj, const FiniteVolumeGrid2D &grid)
 {
-    auto c = A_ * StaticMatrix<4, 1>(
-            {
-                    field(cells_[0]),
-                    field(cells_[1]),
-                    field(cells_[2]),
-                    field(cells_[3])
-            });
+    Point2D bp = ibObj.nearestIntersect(cell_.get().centroid());
+
+    if (bp.x == bp_.x && bp.y == bp_.y)
+        return false;
+
+    bp_ = bp;
+    initImagePoint(grid);
+    computeCoeffs(ibObj);
 
-    return c(0, 0) * ip_.x * ip_.y + c(1, 0) * ip_.x + c(2, 0) * ip_.y + c(3, 0);
+    return true;
 }
 
-Vector2D GhostCellStencil::ipValue(const VectorFiniteVolumeField &field) const
+Scalar GhostCellStencil::ipValue(const ScalarFiniteVolumeField &field) const
 {
-    auto c = A_ * StaticMatrix<4, 2>(
-            {
-                    field(cells_[0]).x, field(cells_[0]).y,
-                    field(cells_[1]).x, field(cells_[1]).y,
-                    field(cells_[2]).x, field(cells_[2]).y,
-                    field(cells_[3]).x, field(cells_[3]).y
-            });
+    return ipWeights_(0, 0) * field(cells_[0])
+           + ipWeights_(0, 1) * field(cells_[1])
+           + ipWeights_(0, 2) * field(cells_[2])
+           + ipWeights_(0, 3) * field(cells_[3]);
+}
 
-    return Vector2D(
-            c(0, 0) * ip_.x * ip_.y + c(1, 0) * ip_.x + c(2, 0) * ip_.y + c(3, 0),
-            c(0, 1) * ip_.x * ip_.y + c(1, 1) * ip_.x + c(2, 1) * ip_.y + c(3, 1)
-    );
+Vector2D GhostCellStencil::ipValue(const VectorFiniteVolumeField &field) const
+{
+    return ipWeights_(0, 0) * field(cells_[0])
+           + ipWeights_(0, 1) * field(cells_[1])
+           + ipWeights_(0, 2) * field(cells_[2])
+           + ipWeights_(0, 3) * field(cells_[3]);
 }
 
 Scalar GhostCellStencil::bpValue(const ScalarFiniteVolumeField &field) const
@@ -167,15 +95,16 @@ Scalar GhostCellStencil::bpValue(const ScalarFiniteVolumeField &field) const
 
 Vector2D GhostCellStencil::ipGrad(const ScalarFiniteVolumeField &field) const
 {
-    auto x = StaticMatrix<2, 4>({ip_.y, 1., 0., 0., ip_.x, 0., 1., 0.}) * A_ * StaticMatrix<4, 1>(
-            {
-                    field(cells_[0]),
-                    field(cells_[1]),
-                    field(cells_[2]),
-                    field(cells_[3])
-            });
+    Vector2D grad(0., 0.);
 
-    return Vector2D(x(0, 0), x(1, 0));
+    for (int i = 0; i < 4; ++i)
+    {
+        Scalar val = field(cells_[i]);
+        grad.x += ipGradWeights_(0, i) * val;
+        grad.y += ipGradWeights_(1, i) * val;
+    }
+
+    return grad;
 }
 
 Vector2D GhostCellStencil::bpGrad(const ScalarFiniteVolumeField &field) const
@@ -206,4 +135,80 @@ Vector2D GhostCellStencil::bpGrad(const ScalarFiniteVolumeField &field) const
     auto x = StaticMatrix<2, 4>({bp_.y, 1., 0., 0., bp_.x, 0., 1., 0.}) * A * b;
 
     return Vector2D(x(0, 0), x(1, 0));
-}
\ No newline at end of file
+}
+
+//- Protected methods
+
+void GhostCellStencil::initImagePoint(const FiniteVolumeGrid2D &grid)
+{
+    ip_ = 2. * bp_ - cell_.get().centroid();
+    auto cells = grid.findNearestNode(ip_).cells();
+
+    if (cells.size() != 4)
+        throw Exception("GhostCellStencil", "initImagePoint", "number of image point cells must be 4.");
+
+    //- The interpolation matrix only depends on the image point cells, so it survives small boundary motions
+    bool sameCells = cells_.size() >= 4;
+    for (int i = 0; i < 4 && sameCells; ++i)
+        sameCells = cells_[i].get().id() == cells[i].get().id();
+
+    cells_.assign(cells.begin(), cells.end());
+
+    if (!sameCells)
+    {
+        Point2D x1 = cells_[0].get().centroid();
+        Point2D x2 = cells_[1].get().centroid();
+        Point2D x3 = cells_[2].get().centroid();
+        Point2D x4 = cells_[3].get().centroid();
+
+        A_ = inverse<4, 4>(
+                {
+                        x1.x * x1.y, x1.x, x1.y, 1.,
+                        x2.x * x2.y, x2.x, x2.y, 1.,
+                        x3.x * x3.y, x3.x, x3.y, 1.,
+                        x4.x * x4.y, x4.x, x4.y, 1.,
+                });
+    }
+
+    //- Image point weights are shared by every field interpolated with this stencil
+    ipWeights_ = StaticMatrix<1, 4>({ip_.x * ip_.y, ip_.x, ip_.y, 1.}) * A_;
+    ipGradWeights_ = StaticMatrix<2, 4>({ip_.y, 1., 0., 0., ip_.x, 0., 1., 0.}) * A_;
+}
+
+bool GhostCellStencil::ghostCellInStencil() const
+{
+    for (int i = 0; i < 4; ++i)
+        if (cells_[i].get().id() == cell_.get().id())
+            return true;
+
+    return false;
+}
+
+void GhostCellStencil::computeCoeffs(const GhostCellImmersedBoundaryObject &ibObj)
+{
+    dirichletCoeffs_.clear();
+    neumannCoeffs_.clear();
+
+    if (ghostCellInStencil())
+    {
+        Vector2D n = ibObj.nearestEdgeNormal(bp_).unitVec();
+        auto xd = StaticMatrix<1, 4>({bp_.x * bp_.y, bp_.x, bp_.y, 1.}) * A_;
+        auto xn = StaticMatrix<1, 4>({{bp_.y * n.x + bp_.x * n.y, n.x, n.y, 0.}}) * A_;
+
+        dirichletCoeffs_.insert(dirichletCoeffs_.end(), xd.data(), xd.data() + 4);
+        neumannCoeffs_.insert(neumannCoeffs_.end(), xn.data(), xn.data() + 4);
+    }
+    else
+    {
+        cells_.push_back(cell_);
+
+        auto xd = ipWeights_ / 2.;
+        auto xn = ipWeights_ / -length();
+
+        dirichletCoeffs_.insert(dirichletCoeffs_.end(), xd.data(), xd.data() + 4);
+        dirichletCoeffs_.push_back(1. / 2.);
+
+        neumannCoeffs_.insert(neumannCoeffs_.end(), xn.data(), xn.data() + 4);
+        neumannCoeffs_.push_back(1. / length());
+    }
+}
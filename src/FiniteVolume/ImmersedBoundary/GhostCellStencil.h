@@ -24,6 +24,9 @@ public:
                      const FiniteVolumeGrid2D &grid);
 
 
+    //- Recompute the stencil if the boundary point moved, returns false if the cached stencil is still valid
+    bool update(const GhostCellImmersedBoundaryObject &ibObj, const FiniteVolumeGrid2D &grid);
+
     const Point2D &boundaryPoint() const
     { return bp_; }
 
@@ -55,7 +58,15 @@ public:
 
 protected:
 
+    void initImagePoint(const FiniteVolumeGrid2D &grid);
+
+    bool ghostCellInStencil() const;
+
+    void computeCoeffs(const GhostCellImmersedBoundaryObject &ibObj);
+
     StaticMatrix<4, 4> A_;
+    StaticMatrix<1, 4> ipWeights_;
+    StaticMatrix<2, 4> ipGradWeights_;
     Point2D ip_, bp_;
 };
 
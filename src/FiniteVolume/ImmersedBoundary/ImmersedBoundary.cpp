@@ -1,6 +1,9 @@
+#include <algorithm>
 #include <fstream>
+#include <limits>
 
 #include "ImmersedBoundary.h"
+#include "ReductionBatch.h"
 #include "SurfaceTensionForce.h"
 #include "StepImmersedBoundaryObject.h"
 #include "QuadraticImmersedBoundaryObject.h"
@@ -122,6 +125,18 @@ ImmersedBoundary::ImmersedBoundary(const Input &input, Solver &solver)
                 ibObject->shape().rotate(rotationAngle.get() * M_PI / 180.);
             }
 
+            boost::optional<Scalar> sdfSpacing = ibObjectInput.second.get_optional<Scalar>(
+                    "geometry.signedDistance.spacing");
+
+            if (sdfSpacing)
+            {
+                Scalar band = ibObjectInput.second.get<Scalar>("geometry.signedDistance.band", 4. * sdfSpacing.get());
+
+                solver.grid().comm().printf("Sampling signed distance of \"%s\" with spacing %lf and band %lf.\n",
+                                            ibObjectInput.first.c_str(), sdfSpacing.get(), band);
+                ibObject->initSignedDistanceField(sdfSpacing.get(), band);
+            }
+
             //- Properties
             ibObject->rho = ibObjectInput.second.get<Scalar>("properties.rho", 0.);
 
@@ -266,11 +281,36 @@ ImmersedBoundary::ImmersedBoundary(const Input &input, Solver &solver)
     if (ibObjs_.empty())
         solver_.grid().comm().printf("No immersed boundaries present.\n");
 
-    for(const Node& node: grid().nodes())
+    //- The local domain includes the buffer cells
+    Point2D lower(std::numeric_limits<Scalar>::infinity(), std::numeric_limits<Scalar>::infinity());
+    Point2D upper = -lower;
+
+    for (const Node &node: grid().nodes())
     {
-        if(!ibObj(node))
-            fluidNodes_.add(node);
+        lower = Point2D(std::min(lower.x, node.x), std::min(lower.y, node.y));
+        upper = Point2D(std::max(upper.x, node.x), std::max(upper.y, node.y));
     }
+
+    auto lowers = grid().comm().allGather(lower);
+    auto uppers = grid().comm().allGather(upper);
+
+    for (int proc = 0; proc < grid().comm().nProcs(); ++proc)
+        procBoxes_.push_back(boost::geometry::model::box<Point2D>(lowers[proc], uppers[proc]));
+
+    updateOwnership();
+    updateIbObjTree();
+
+    //- Point location is thread-safe, group insertion is not
+    const std::vector<Node> &nodes = grid().nodes();
+    std::vector<char> isFluidNode(nodes.size());
+
+#pragma omp parallel for
+    for(int i = 0; i < nodes.size(); ++i)
+        isFluidNode[i] = !ibObj(nodes[i]);
+
+    for(int i = 0; i < nodes.size(); ++i)
+        if(isFluidNode[i])
+            fluidNodes_.add(nodes[i]);
 }
 
 const Solver &ImmersedBoundary::solver() const
@@ -290,7 +330,9 @@ void ImmersedBoundary::initCellZones(CellZone &zone)
     for (auto &ibObj: ibObjs_)
     {
         ibObj->setZone(zone);
-        ibObj->updateCells();
+
+        if (ibObj->isLocal())
+            ibObj->updateCells();
     }
 
     setCellStatus();
@@ -329,11 +371,15 @@ CellGroup ImmersedBoundary::solidCells() const
 
 std::shared_ptr<const ImmersedBoundaryObject> ImmersedBoundary::ibObj(const Point2D &pt) const
 {
-    for (const auto &ibObj: ibObjs_)
-        if (ibObj->isInIb(pt))
-            return ibObj;
+    namespace bgi = boost::geometry::index;
 
-    return nullptr;
+    //- Overlapping objects resolve to the first one in input order, as with a linear search
+    Label first = ibObjs_.size();
+    for (auto it = ibObjTree_.qbegin(bgi::intersects(pt)); it != ibObjTree_.qend(); ++it)
+        if (it->second < first && ibObjs_[it->second]->isInIb(pt))
+            first = it->second;
+
+    return first < ibObjs_.size() ? ibObjs_[first] : nullptr;
 }
 
 const ImmersedBoundaryObject &ImmersedBoundary::ibObj(const std::string &name) const
@@ -357,17 +403,37 @@ std::vector<Ref<const ImmersedBoundaryObject> > ImmersedBoundary::ibObjs() const
 
 void ImmersedBoundary::update(Scalar timeStep)
 {
-    for (auto &ibObj: ibObjs_)
-        ibObj->update(timeStep);
+    //- Every proc knows which objects move, so all procs take the same early exit
+    if (std::none_of(ibObjs_.begin(), ibObjs_.end(),
+                     [](const std::shared_ptr<ImmersedBoundaryObject> &ibObj) { return ibObj->isMoving(); }))
+        return;
 
-    setCellStatus();
-    solver_.grid().computeGlobalOrdering();
+    //- Only the regions swept by moving objects can change status. Forced objects are only tracked by their owners
+    std::vector<Box> sweptBoxes;
 
-    for(const Node& node: grid().nodes())
+    for (auto &ibObj: ibObjs_)
+        if (ibObj->isMoving() && (!ibObj->isForced() || ibObj->isLocal()))
+        {
+            auto box = ibObj->shape().boundingBox();
+            ibObj->update(timeStep);
+            boost::geometry::expand(box, ibObj->shape().boundingBox());
+            sweptBoxes.push_back(Box(box.min_corner(), box.max_corner()));
+        }
+
+    //- The last known position of an object entering this domain lies outside of it, only the new one matters
+    for (Label id: sendForcedMotions())
     {
-        if(!ibObj(node))
-            fluidNodes_.add(node);
+        auto box = ibObjs_[id]->shape().boundingBox();
+        sweptBoxes.push_back(Box(box.min_corner(), box.max_corner()));
     }
+
+    updateOwnership();
+    updateIbObjTree();
+
+    bool statusChanged = updateCellStatus(sweptBoxes);
+    updateFluidNodes(sweptBoxes);
+
+    solver_.grid().updateGlobalOrdering(statusChanged);
 }
 
 Equation<Vector2D> ImmersedBoundary::velocityBcs(VectorFiniteVolumeField &u) const
@@ -375,7 +441,8 @@ Equation<Vector2D> ImmersedBoundary::velocityBcs(VectorFiniteVolumeField &u) con
     Equation<Vector2D> eqn(u);
 
     for (const auto &ibObj: ibObjs_)
-        eqn += ibObj->velocityBcs(u);
+        if (ibObj->isLocal())
+            eqn += ibObj->velocityBcs(u);
 
     return eqn;
 }
@@ -385,7 +452,8 @@ Equation<Scalar> ImmersedBoundary::pressureBcs(Scalar rho, ScalarFiniteVolumeFie
     Equation<Scalar> eqn(p);
 
     for (const auto &ibObj: ibObjs_)
-        eqn += ibObj->pressureBcs(rho, p);
+        if (ibObj->isLocal())
+            eqn += ibObj->pressureBcs(rho, p);
 
     return eqn;
 }
@@ -395,7 +463,8 @@ Equation<Scalar> ImmersedBoundary::contactLineBcs(const SurfaceTensionForce &fst
     Equation<Scalar> eqn(gamma);
 
     for (const auto &ibObj: ibObjs_)
-        eqn += ibObj->contactLineBcs(gamma, fst.getTheta(*ibObj));
+        if (ibObj->isLocal())
+            eqn += ibObj->contactLineBcs(gamma, fst.getTheta(*ibObj));
 
     return eqn;
 }
@@ -408,13 +477,7 @@ void ImmersedBoundary::clearFreshCells()
 
 bool ImmersedBoundary::isIbCell(const Cell &cell) const
 {
-    for (const auto &ibObj: ibObjs_)
-    {
-        if (ibObj->isInIb(cell.centroid()))
-            return true;
-    }
-
-    return false;
+    return ibObj(cell.centroid()) != nullptr;
 }
 
 void ImmersedBoundary::computeForce(Scalar rho,
@@ -424,16 +487,10 @@ void ImmersedBoundary::computeForce(Scalar rho,
                                     const Vector2D &g)
 {
     for (auto ibObj: ibObjs_)
-        ibObj->computeForce(rho, mu, u, p, g);
-
-    if (collisionModel_)
-        for (auto ibObjP: ibObjs_)
-        {
-            for (auto ibObjQ: ibObjs_)
-                ibObjP->addForce(collisionModel_->force(*ibObjP, *ibObjQ));
+        if (ibObj->isLocal())
+            ibObj->computeForce(rho, mu, u, p, g);
 
-            ibObjP->addForce(collisionModel_->force(*ibObjP, ibObjP->grid()));
-        }
+    reduceForces();
 }
 
 void ImmersedBoundary::computeForce(const ScalarFiniteVolumeField &rho,
@@ -443,16 +500,10 @@ void ImmersedBoundary::computeForce(const ScalarFiniteVolumeField &rho,
                                     const Vector2D &g)
 {
     for (auto ibObj: ibObjs_)
-        ibObj->computeForce(rho, mu, u, p, g);
-
-    if (collisionModel_)
-        for (auto ibObjP: ibObjs_)
-        {
-            for (auto ibObjQ: ibObjs_)
-                ibObjP->addForce(collisionModel_->force(*ibObjP, *ibObjQ));
+        if (ibObj->isLocal())
+            ibObj->computeForce(rho, mu, u, p, g);
 
-            ibObjP->addForce(collisionModel_->force(*ibObjP, ibObjP->grid()));
-        }
+    reduceForces();
 }
 
 //- Protected
@@ -483,3 +534,249 @@ void ImmersedBoundary::setCellStatus()
             cellStatus_(cell) = DEAD_CELLS;
     }
 }
+
+void ImmersedBoundary::updateIbObjTree()
+{
+    std::vector<IbObjBox> boxes;
+    boxes.reserve(ibObjs_.size());
+
+    for (Label i = 0; i < ibObjs_.size(); ++i)
+        boxes.push_back(std::make_pair(ibObjs_[i]->shape().boundingBox(), i));
+
+    //- Bulk loading produces a better packed tree than repeated insertion
+    ibObjTree_ = decltype(ibObjTree_)(boxes.begin(), boxes.end());
+}
+
+bool ImmersedBoundary::updateCellStatus(const std::vector<Box> &sweptBoxes)
+{
+    //- Some objects also claim the neighbours of their solid cells, so one extra layer is checked
+    CellGroup cells;
+
+    for (const Box &box: sweptBoxes)
+    {
+        cells.addAll(grid().localActiveCells().itemsCoveredBy(box));
+
+        for (const CellZone &bufferZone: grid().bufferZones())
+            cells.addAll(bufferZone.itemsCoveredBy(box));
+    }
+
+    for (const Cell &cell: cells.items())
+        for (const InteriorLink &nb: cell.neighbours())
+            cells.add(nb.cell());
+
+    //- Same precedence as setCellStatus. Each object writes the status of its own cells, so the cost scales with the
+    //- swept cells plus the object cells rather than with their product. Only the swept cells are read back
+    std::vector<int> status(grid().cells().size(), 0);
+
+    for (const Cell &cell: cells)
+    {
+        if (grid().cellZone("fluid").isInGroup(cell))
+            status[cell.id()] = FLUID_CELLS;
+
+        for (const CellZone &bufferZone: grid().bufferZones())
+            if (bufferZone.isInGroup(cell))
+                status[cell.id()] = BUFFER_CELLS;
+    }
+
+    for (const auto &ibObj: ibObjs_)
+    {
+        if (!ibObj->isLocal())
+            continue;
+
+        for (const Cell &cell: ibObj->ibCells())
+            status[cell.id()] = IB_CELLS;
+
+        for (const Cell &cell: ibObj->solidCells())
+            status[cell.id()] = SOLID_CELLS;
+
+        for (const Cell &cell: ibObj->freshCells())
+            status[cell.id()] = FRESH_CELLS;
+
+        for (const Cell &cell: ibObj->deadCells())
+            status[cell.id()] = DEAD_CELLS;
+    }
+
+    bool statusChanged = false;
+    for (const Cell &cell: cells)
+        if (cellStatus_(cell) != status[cell.id()])
+        {
+            cellStatus_(cell) = status[cell.id()];
+            statusChanged = true;
+        }
+
+    return statusChanged;
+}
+
+void ImmersedBoundary::updateFluidNodes(const std::vector<Box> &sweptBoxes)
+{
+    NodeGroup nodes, coveredNodes;
+
+    for (const Box &box: sweptBoxes)
+    {
+        nodes.addAll(grid().interiorNodes().itemsCoveredBy(box));
+        nodes.addAll(grid().boundaryNodes().itemsCoveredBy(box));
+    }
+
+    for (const Node &node: nodes)
+    {
+        if (ibObj(node))
+            coveredNodes.add(node);
+        else
+            fluidNodes_.add(node);
+    }
+
+    fluidNodes_.remove(coveredNodes);
+}
+
+std::vector<int> ImmersedBoundary::ownersOf(const ImmersedBoundaryObject &ibObj) const
+{
+    auto box = ibObj.shape().boundingBox();
+
+    //- Every proc with walls in collision range must take part in the force
+    if (collisionModel_)
+    {
+        Vector2D range(collisionModel_->range(), collisionModel_->range());
+        box = decltype(box)(box.min_corner() - range, box.max_corner() + range);
+    }
+
+    std::vector<int> owners;
+
+    for (int proc = 0; proc < procBoxes_.size(); ++proc)
+        if (boost::geometry::intersects(box, procBoxes_[proc]))
+            owners.push_back(proc);
+
+    //- Objects outside of every domain still need a proc to compute their force
+    if (owners.empty())
+        owners.push_back(grid().comm().mainProcNo());
+
+    return owners;
+}
+
+std::vector<Label> ImmersedBoundary::sendForcedMotions()
+{
+    const int tag = 1000;
+    std::vector<std::pair<int, std::vector<Scalar>>> messages;
+
+    for (Label i = 0; i < ibObjs_.size(); ++i)
+    {
+        const ImmersedBoundaryObject &ibObj = *ibObjs_[i];
+
+        if (ibObj.isForced() && ibObj.isLocal() && ibObj.comm().rank() == 0)
+        {
+            const std::vector<int> &owners = ibObj.owners();
+
+            for (int proc: ownersOf(ibObj))
+                if (!std::binary_search(owners.begin(), owners.end(), proc))
+                {
+                    std::vector<Scalar> msg(1, i);
+                    std::vector<Scalar> state = ibObjs_[i]->motion()->state();
+                    msg.insert(msg.end(), state.begin(), state.end());
+                    messages.push_back(std::make_pair(proc, msg));
+                }
+        }
+    }
+
+    std::vector<Label> ids;
+
+    for (const auto &msg: grid().comm().sparseExchange(messages, tag))
+    {
+        Label i = (Label) msg.second[0];
+        ibObjs_[i]->setMotionState(std::vector<Scalar>(msg.second.begin() + 1, msg.second.end()));
+        ids.push_back(i);
+    }
+
+    return ids;
+}
+
+void ImmersedBoundary::reduceForces()
+{
+    std::vector<Vector2D> collisionForces(ibObjs_.size(), Vector2D(0., 0.));
+
+    if (collisionModel_)
+    {
+        std::vector<Label> ids;
+        std::vector<CollisionModel::BoundingBox> boxes;
+
+        for (Label i = 0; i < ibObjs_.size(); ++i)
+            if (ibObjs_[i]->isLocal())
+            {
+                ids.push_back(i);
+                boxes.push_back(ibObjs_[i]->shape().boundingBox());
+                collisionForces[i] = collisionModel_->localForce(*ibObjs_[i], grid());
+            }
+
+        //- Objects in collision range share an owner. Each pair is evaluated once, on the lowest proc owning
+        //- both, and the reaction is applied to the other object
+        for (const auto &pair: collisionModel_->candidatePairs(boxes))
+        {
+            const ImmersedBoundaryObject &ibObjP = *ibObjs_[ids[pair.first]], &ibObjQ = *ibObjs_[ids[pair.second]];
+            std::vector<int> common;
+
+            std::set_intersection(ibObjP.owners().begin(), ibObjP.owners().end(),
+                                  ibObjQ.owners().begin(), ibObjQ.owners().end(), std::back_inserter(common));
+
+            if (!common.empty() && common.front() == grid().comm().rank())
+            {
+                Vector2D fc = collisionModel_->force(ibObjP, ibObjQ);
+                collisionForces[ids[pair.first]] += fc;
+                collisionForces[ids[pair.second]] -= fc;
+            }
+        }
+    }
+
+    //- An object's fluid force is complete on the first of its owners, and the collision forces are partial on
+    //- each owner. Objects with a single owner need no communication. The forces of objects shared between procs
+    //- are summed in one batch, every proc knows all owners and so enqueues the same entries
+    ReductionBatch reductions(grid().comm());
+    std::vector<ReductionBatch::Result> forces(3 * ibObjs_.size());
+
+    for (Label i = 0; i < ibObjs_.size(); ++i)
+    {
+        ImmersedBoundaryObject &ibObj = *ibObjs_[i];
+        Vector2D force(0., 0.);
+        Scalar torque = 0.;
+
+        if (ibObj.isLocal())
+        {
+            force = collisionForces[i];
+
+            if (ibObj.comm().rank() == 0)
+            {
+                force += ibObj.force();
+                torque = ibObj.torque();
+            }
+        }
+
+        if (ibObj.owners().size() > 1)
+        {
+            forces[3 * i] = reductions.sum(force.x);
+            forces[3 * i + 1] = reductions.sum(force.y);
+            forces[3 * i + 2] = reductions.sum(torque);
+        }
+        else if (ibObj.isLocal())
+            ibObj.setForce(force, torque);
+    }
+
+    reductions.start();
+
+    for (Label i = 0; i < ibObjs_.size(); ++i)
+        if (ibObjs_[i]->isLocal() && ibObjs_[i]->owners().size() > 1)
+            ibObjs_[i]->setForce(Vector2D(forces[3 * i].get(), forces[3 * i + 1].get()), forces[3 * i + 2].get());
+}
+
+void ImmersedBoundary::updateOwnership()
+{
+    for (auto &ibObj: ibObjs_)
+    {
+        bool wasLocal = ibObj->isLocal();
+        ibObj->setOwners(ownersOf(*ibObj));
+
+        if (!zone_)
+            continue;
+
+        if (wasLocal && !ibObj->isLocal())
+            ibObj->clear();
+        else if (!wasLocal && ibObj->isLocal())
+            ibObj->updateCells();
+    }
+}
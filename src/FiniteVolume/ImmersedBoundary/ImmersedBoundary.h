@@ -1,6 +1,8 @@
 #ifndef IMMERSED_BOUNDARY_H
 #define IMMERSED_BOUNDARY_H
 
+#include <boost/geometry/index/rtree.hpp>
+
 #include "ImmersedBoundaryObject.h"
 #include "CollisionModel.h"
 
@@ -72,7 +74,8 @@ public:
         Equation<T> eqn(field);
 
         for (const auto &ibObj: ibObjs_)
-            eqn += ibObj->bcs(field);
+            if (ibObj->isLocal())
+                eqn += ibObj->bcs(field);
 
         return eqn;
     }
@@ -103,6 +106,26 @@ protected:
 
     void setCellStatus();
 
+    //- Incremental updates restricted to the regions swept by moving objects. Returns true if any status changed
+    bool updateCellStatus(const std::vector<Box> &sweptBoxes);
+
+    void updateFluidNodes(const std::vector<Box> &sweptBoxes);
+
+    //- Sum the force of each object, including collisions, over its owners
+    void reduceForces();
+
+    //- Procs whose domains overlap the object grown by the collision range
+    std::vector<int> ownersOf(const ImmersedBoundaryObject &ibObj) const;
+
+    //- Send the state of forced objects to the procs they move onto. Returns the indices of the objects received
+    std::vector<Label> sendForcedMotions();
+
+    //- Assign objects to the procs whose domains they overlap, must be called whenever objects move
+    void updateOwnership();
+
+    //- Rebuild the search tree over object bounding boxes, must be called whenever objects move
+    void updateIbObjTree();
+
     const CellZone *zone_ = nullptr;
     NodeGroup fluidNodes_;
 
@@ -110,6 +133,13 @@ protected:
     FiniteVolumeField<int> &cellStatus_;
     std::vector<std::shared_ptr<ImmersedBoundaryObject>> ibObjs_;
 
+    //- Bounding boxes of the ib objects, paired with the object index
+    typedef std::pair<boost::geometry::model::box<Point2D>, Label> IbObjBox;
+    boost::geometry::index::rtree<IbObjBox, boost::geometry::index::quadratic<16>> ibObjTree_;
+
+    //- Bounding boxes of the local domains of all procs, including buffer cells
+    std::vector<boost::geometry::model::box<Point2D>> procBoxes_;
+
     //- Collision model
     std::shared_ptr<CollisionModel> collisionModel_;
 };
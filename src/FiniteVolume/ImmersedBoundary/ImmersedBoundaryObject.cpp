@@ -1,4 +1,5 @@
 #include <memory>
+#include <algorithm>
 
 #include "ImmersedBoundaryObject.h"
 #include "TranslatingMotion.h"
@@ -37,6 +38,14 @@ void ImmersedBoundaryObject::initBox(const Point2D &center, Scalar width, Scalar
     );
 }
 
+void ImmersedBoundaryObject::initSignedDistanceField(Scalar spacing, Scalar band)
+{
+    if (shapePtr_->type() != Shape2D::POLYGON)
+        throw Exception("ImmersedBoundaryObject", "initSignedDistanceField", "only available for polygons.");
+
+    sdf_ = std::make_shared<SignedDistanceField>(*std::static_pointer_cast<Polygon>(shapePtr_), spacing, band);
+}
+
 void ImmersedBoundaryObject::setMotion(std::shared_ptr<Motion> motion)
 {
     motion_ = motion;
@@ -48,6 +57,23 @@ void ImmersedBoundaryObject::setZone(CellZone &zone)
     cells_ = CellZone("Cells", zone.registry());
 }
 
+void ImmersedBoundaryObject::setOwners(const std::vector<int> &owners)
+{
+    if (owners == owners_)
+        return;
+
+    owners_ = owners;
+
+    //- Only the owners take part in creating the communicator. Most objects have a single owner and need no new
+    //- communicator, which also keeps the number of MPI contexts proportional to the objects crossing proc boundaries
+    if (std::find(owners_.begin(), owners_.end(), grid_.comm().rank()) == owners_.end())
+        ownerComm_ = nullptr;
+    else if (owners_.size() == 1)
+        ownerComm_ = std::make_shared<Communicator>(MPI_COMM_SELF);
+    else
+        ownerComm_ = grid_.comm().createGroupComm(owners_, id_);
+}
+
 void ImmersedBoundaryObject::clear()
 {
     fluid_->add(cells_);
@@ -85,7 +111,7 @@ Vector2D ImmersedBoundaryObject::nearestEdgeNormal(const Point2D &pt) const
         case Shape2D::BOX:
         case Shape2D::POLYGON:
         {
-            auto edge = shapePtr_->nearestEdge(pt);
+            auto edge = sdf_ ? sdf_->nearestEdge(pt) : shapePtr_->nearestEdge(pt);
             return dot(edge.norm(), shapePtr_->centroid() - edge.center()) > 0. ? edge.norm().unitVec()
                                                                                 : -edge.norm().unitVec();
         }
@@ -101,8 +127,8 @@ std::pair<Point2D, Vector2D> ImmersedBoundaryObject::intersectionStencil(const P
     Point2D xc;
     if (intersections.empty()) //- fail safe, in case a point is on an ib
     {
-        Point2D nPtA = shape().nearestIntersect(ptA);
-        Point2D nPtB = shape().nearestIntersect(ptB);
+        Point2D nPtA = nearestIntersect(ptA);
+        Point2D nPtB = nearestIntersect(ptB);
 
         if ((nPtA - ptA).magSqr() < (nPtB - ptB).magSqr())
             xc = ptA;
@@ -112,7 +138,7 @@ std::pair<Point2D, Vector2D> ImmersedBoundaryObject::intersectionStencil(const P
     else
         xc = intersections[0];
 
-    LineSegment2D edge = shapePtr_->nearestEdge(xc);
+    LineSegment2D edge = sdf_ ? sdf_->nearestEdge(xc) : shapePtr_->nearestEdge(xc);
 
     return std::make_pair(
             xc, -(edge.ptB() - edge.ptA()).normalVec()
@@ -228,11 +254,46 @@ void ImmersedBoundaryObject::computeForce(const ScalarFiniteVolumeField &rho,
 
 void ImmersedBoundaryObject::update(Scalar timeStep)
 {
-    if (motion_)
-    {
+    if (!motion_)
+        return;
+
+    if (!motion_->isForced())
         motion_->update(timeStep);
-        updateCells();
+    else if (isLocal())
+    {
+        std::vector<Scalar> state(Motion::STATE_SIZE);
+
+        if (ownerComm_->rank() == 0)
+        {
+            motion_->update(timeStep);
+            state = motion_->state();
+        }
+
+        if (owners_.size() > 1)
+        {
+            ownerComm_->broadcast(0, state);
+
+            if (ownerComm_->rank() != 0)
+                motion_->setState(state);
+        }
     }
+    else
+        return;
+
+    if (sdf_)
+        sdf_->setPose(*std::static_pointer_cast<Polygon>(shapePtr_));
+
+    //- Procs that do not own the object only track its position
+    if (isLocal())
+        updateCells();
+}
+
+void ImmersedBoundaryObject::setMotionState(const std::vector<Scalar> &state)
+{
+    motion_->setState(state);
+
+    if (sdf_)
+        sdf_->setPose(*std::static_pointer_cast<Polygon>(shapePtr_));
 }
 
 void ImmersedBoundaryObject::updateCells()
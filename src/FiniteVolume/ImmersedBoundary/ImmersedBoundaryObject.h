@@ -2,6 +2,7 @@
 #define IMMERSED_BOUNDARY_OBJECT_H
 
 #include "Shape2D.h"
+#include "SignedDistanceField.h"
 #include "Equation.h"
 #include "Motion.h"
 
@@ -43,12 +44,18 @@ public:
     const Shape2D &shape() const
     { return *shapePtr_; }
 
+    //- Optional signed distance lattice for polygons, used for inside and nearest point queries
+    void initSignedDistanceField(Scalar spacing, Scalar band);
+
+    bool hasSignedDistanceField() const
+    { return (bool) sdf_; }
+
     bool isInIb(const Point2D &pt) const
-    { return shapePtr_->isInside(pt); }
+    { return sdf_ ? sdf_->isInside(pt) : shapePtr_->isInside(pt); }
 
     template<class T>
     bool isInIb(const T &item) const
-    { return shapePtr_->isInside(item.centroid()); }
+    { return isInIb(item.centroid()); }
 
     template<class const_iterator>
     bool allInIb(const_iterator begin, const_iterator end) const
@@ -74,6 +81,12 @@ public:
     std::shared_ptr<Motion> motion()
     { return motion_; }
 
+    bool isForced() const
+    { return motion_ && motion_->isForced(); }
+
+    //- Adopt a motion integrated on another proc
+    void setMotionState(const std::vector<Scalar> &state);
+
     //- Set/get primary cell zone
     void setZone(CellZone &zone);
 
@@ -88,16 +101,32 @@ public:
     const FiniteVolumeGrid2D &grid() const
     { return grid_; }
 
+    //- Ownership, only procs whose domain overlaps the object track its cells and compute its force
+    void setOwners(const std::vector<int> &owners);
+
+    const std::vector<int> &owners() const
+    { return owners_; }
+
+    bool isLocal() const
+    { return (bool) ownerComm_; }
+
+    //- Communicator over the owning procs
+    const Communicator &comm() const
+    { return ownerComm_ ? *ownerComm_ : grid_.comm(); }
+
     //- Operations
     LineSegment2D intersectionLine(const LineSegment2D &ln) const;
 
     LineSegment2D intersectionLine(const Point2D &ptA, const Point2D &ptB) const;
 
     Point2D nearestIntersect(const Point2D &pt) const
-    { return shapePtr_->nearestIntersect(pt); }
+    { return sdf_ ? sdf_->nearestIntersect(pt) : shapePtr_->nearestIntersect(pt); }
 
     Vector2D nearestEdgeNormal(const Point2D &pt) const;
 
+    Point2D intersection(const Ray2D &ray) const
+    { return sdf_ ? sdf_->intersection(ray) : shapePtr_->intersections(ray)[0]; }
+
     std::pair<Point2D, Vector2D> intersectionStencil(const Point2D &ptA,
                                                      const Point2D &ptB) const; // returns a intersection point and the edge normal
 
@@ -173,6 +202,12 @@ public:
         force_ += force;
     }
 
+    void setForce(const Vector2D &force, Scalar torque)
+    {
+        force_ = force;
+        torque_ = torque;
+    }
+
     Scalar mass() const
     { return rho * shapePtr_->area(); }
 
@@ -185,7 +220,8 @@ public:
     Scalar torque() const
     { return torque_; }
 
-    //- Update
+    //- Update. Forced motions are integrated by the first owner and broadcast to the other owners, procs that
+    //- do not own a forced object keep its last known position
     void update(Scalar timeStep);
 
     virtual void updateCells();
@@ -228,7 +264,11 @@ protected:
     CellZone cells_, ibCells_, solidCells_, freshCells_, deadCells_;
     CellZone *fluid_ = nullptr;
 
+    std::vector<int> owners_;
+    std::shared_ptr<Communicator> ownerComm_;
+
     std::shared_ptr<Shape2D> shapePtr_;
+    std::shared_ptr<SignedDistanceField> sdf_;
 
     std::map<std::string, BoundaryType> boundaryTypes_;
     std::map<std::string, Scalar> boundaryRefScalars_;
@@ -11,4 +11,27 @@ Motion::Motion(std::weak_ptr<ImmersedBoundaryObject> ibObj)
     alpha_ = 0.;
     omega_ = 0.;
     theta_ = 0.;
-}
\ No newline at end of file
+}
+std::vector<Scalar> Motion::state() const
+{
+    return {pos_.x, pos_.y, vel_.x, vel_.y, acc_.x, acc_.y, theta_, omega_, alpha_};
+}
+
+void Motion::setState(const std::vector<Scalar> &state)
+{
+    if (state.size() != STATE_SIZE)
+        throw Exception("Motion", "setState", "state has the wrong size.");
+
+    Scalar theta0 = theta_;
+
+    pos_ = Vector2D(state[0], state[1]);
+    vel_ = Vector2D(state[2], state[3]);
+    acc_ = Vector2D(state[4], state[5]);
+    theta_ = state[6];
+    omega_ = state[7];
+    alpha_ = state[8];
+
+    auto ibObj = ibObj_.lock();
+    ibObj->shape().move(pos_);
+    ibObj->shape().rotate(theta_ - theta0);
+}
@@ -1,6 +1,8 @@
 #ifndef MOTION_H
 #define MOTION_H
 
+#include <vector>
+
 #include "Point2D.h"
 
 class ImmersedBoundaryObject;
@@ -13,6 +15,17 @@ public:
 
     virtual void update(Scalar timeStep) = 0;
 
+    //- Motions driven by the fluid force are integrated by the first owner of their object only
+    virtual bool isForced() const
+    { return false; }
+
+    //- Kinematic state, used to pass an integrated motion to the other procs tracking the object
+    enum {STATE_SIZE = 9};
+
+    std::vector<Scalar> state() const;
+
+    void setState(const std::vector<Scalar> &state);
+
     const Vector2D &acceleration() const
     { return acc_; }
 
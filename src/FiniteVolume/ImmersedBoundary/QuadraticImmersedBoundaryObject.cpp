@@ -213,14 +213,14 @@ void QuadraticImmersedBoundaryObject::computeForce(Scalar rho,
 //                }
             }
 
-    bPts = grid_.comm().allGatherv(bPts);
-    bP = grid_.comm().allGatherv(bP);
+    bPts = comm().allGatherv(bPts);
+    bP = comm().allGatherv(bP);
 
-    tauPtsX = grid_.comm().allGatherv(tauPtsX);
-    tauX = grid_.comm().allGatherv(tauX);
+    tauPtsX = comm().allGatherv(tauPtsX);
+    tauX = comm().allGatherv(tauX);
 
-    tauPtsY = grid_.comm().allGatherv(tauPtsY);
-    tauY = grid_.comm().allGatherv(tauY);
+    tauPtsY = comm().allGatherv(tauPtsY);
+    tauY = comm().allGatherv(tauY);
 
     std::vector <ScalarPoint> pPoints, tauXPoints, tauYPoints;
 
@@ -380,14 +380,14 @@ void QuadraticImmersedBoundaryObject::computeForce(const ScalarFiniteVolumeField
 //                }
             }
 
-    bPts = grid_.comm().allGatherv(bPts);
-    bP = grid_.comm().allGatherv(bP);
+    bPts = comm().allGatherv(bPts);
+    bP = comm().allGatherv(bP);
 
-    tauPtsX = grid_.comm().allGatherv(tauPtsX);
-    tauX = grid_.comm().allGatherv(tauX);
+    tauPtsX = comm().allGatherv(tauPtsX);
+    tauX = comm().allGatherv(tauX);
 
-    tauPtsY = grid_.comm().allGatherv(tauPtsY);
-    tauY = grid_.comm().allGatherv(tauY);
+    tauPtsY = comm().allGatherv(tauPtsY);
+    tauY = comm().allGatherv(tauY);
 
     std::vector <ScalarPoint> pPoints, tauXPoints, tauYPoints;
     pPoints.reserve(bP.size());
@@ -13,6 +13,9 @@ public:
 
     void update(Scalar timeStep);
 
+    bool isForced() const
+    { return true; }
+
 private:
 
     Vector2D force_;
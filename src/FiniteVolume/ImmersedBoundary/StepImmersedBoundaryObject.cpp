@@ -154,14 +154,14 @@ void StepImmersedBoundaryObject::computeForce(Scalar rho,
                 }
             }
 
-    bPts = grid_.comm().allGatherv(bPts);
-    bP = grid_.comm().allGatherv(bP);
+    bPts = comm().allGatherv(bPts);
+    bP = comm().allGatherv(bP);
 
-    tauPtsX = grid_.comm().allGatherv(tauPtsX);
-    tauX = grid_.comm().allGatherv(tauX);
+    tauPtsX = comm().allGatherv(tauPtsX);
+    tauX = comm().allGatherv(tauX);
 
-    tauPtsY = grid_.comm().allGatherv(tauPtsY);
-    tauY = grid_.comm().allGatherv(tauY);
+    tauPtsY = comm().allGatherv(tauPtsY);
+    tauY = comm().allGatherv(tauY);
 
     std::vector<ScalarPoint> pPoints, tauXPoints, tauYPoints;
 
@@ -302,8 +302,8 @@ void StepImmersedBoundaryObject::computeForce(const ScalarFiniteVolumeField &rho
                 bP.push_back(pB + rhoB * dot(g, ln.ptB()));
             }
 
-    bPts = grid_.comm().allGatherv(bPts);
-    bP = grid_.comm().allGatherv(bP);
+    bPts = comm().allGatherv(bPts);
+    bP = comm().allGatherv(bP);
 
     std::vector<ScalarPoint> pPoints;
     std::transform(bPts.begin(), bPts.end(), bP.begin(), std::back_inserter(pPoints), [](const Point2D &pt, Scalar p) {
@@ -53,6 +53,15 @@ void CellZone::remove(const Cell &cell)
     }
 }
 
+void CellZone::remove(const CellGroup &cells)
+{
+    for (const Cell &cell: cells)
+        if (isInGroup(cell))
+            registry_->erase(cell.id());
+
+    CellGroup::remove(cells);
+}
+
 void CellZone::clear()
 {
     for (const Cell &cell: items_)
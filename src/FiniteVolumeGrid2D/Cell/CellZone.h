@@ -29,6 +29,8 @@ public:
 
     void remove(const Cell &cell);
 
+    void remove(const CellGroup &cells);
+
     void clear();
 
     std::shared_ptr<ZoneRegistry> registry() const
@@ -93,47 +93,7 @@ void CgnsUnstructuredGrid::loadPartitionedGrid(std::shared_ptr<Communicator> com
     cg_close(fid);
 
     //- Construct the buffer zones
-    sendCellGroups_.resize(comm_->nProcs());
-    bufferCellZones_.resize(comm_->nProcs());
-
-    for (int proc = 0; proc < comm_->nProcs(); ++proc)
-    {
-        sendCellGroups_[proc] = CellGroup("Proc" + std::to_string(proc));
-        bufferCellZones_[proc] = CellZone("Proc" + std::to_string(proc), localActiveCells_.registry());
-    }
-
-    //- Construct the buffer regions
-    for (const Cell &cell: cells_)
-        if (procNo[cell.id()] != comm_->rank())
-            bufferCellZones_[procNo[cell.id()]].add(cell);
-
-    //- Create a global to local id map
-    std::unordered_map<int, int> globalToLocalIdMap;
-    for (int id = 0; id < globalIds.size(); ++id)
-        globalToLocalIdMap[globalIds[id]] = id;
-
-    //- Communicate send orders
-    std::vector<std::vector<unsigned long>> recvOrders(comm_->nProcs());
-    for (int proc = 0; proc < comm_->nProcs(); ++proc)
-    {
-        std::transform(bufferCellZones_[proc].begin(), bufferCellZones_[proc].end(),
-                       std::back_inserter(recvOrders[proc]), [&globalIds](const Cell &cell) {
-                    return globalIds[cell.id()];
-                });
-
-        comm_->isend(proc, recvOrders[proc], proc);
-    }
-
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
-    {
-        std::vector<unsigned long> sendOrder(comm_->probeSize<unsigned long>(proc, comm_->rank()));
-        comm_->recv(proc, sendOrder, comm_->rank());
-
-        for(Label gid: sendOrder)
-            sendCellGroups_[proc].add(cells_[globalToLocalIdMap[gid]]);
-    }
-
-    comm_->waitAll();
+    initCommunication(procNo, std::vector<Label>(globalIds.begin(), globalIds.end()));
     computeGlobalOrdering();
 }
 
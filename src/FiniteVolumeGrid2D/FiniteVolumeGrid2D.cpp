@@ -8,7 +8,9 @@
 FiniteVolumeGrid2D::FiniteVolumeGrid2D()
         :
         interiorFaces_("InteriorFaces"),
-        boundaryFaces_("BoundaryFaces")
+        boundaryFaces_("BoundaryFaces"),
+        localInteriorFaces_("LocalInteriorFaces"),
+        bufferFaces_("BufferFaces")
 {
     auto registry = std::make_shared<CellZone::ZoneRegistry>();
     localActiveCells_ = CellZone("LocalActiveCells", registry);
@@ -57,6 +59,8 @@ void FiniteVolumeGrid2D::init(const std::vector<Point2D> &nodes,
 
     initConnectivity();
     computeBoundingBox();
+
+    ++geometryVersion_;
 }
 
 void FiniteVolumeGrid2D::reset()
@@ -85,6 +89,12 @@ void FiniteVolumeGrid2D::reset()
     //- Communication zones
     sendCellGroups_.clear(); // shared pointers are used so that zones can be moveable!
     bufferCellZones_.clear();
+    neighbourProcs_.clear();
+    neighbourComm_ = nullptr;
+    sharedMemoryComm_ = nullptr;
+    neighbourSharedRanks_.clear();
+    localInteriorCells_.clear();
+    localBoundaryCells_.clear();
 
     //- Face related data
     faces_.clear();
@@ -93,6 +103,8 @@ void FiniteVolumeGrid2D::reset()
     //- Interior and boundary face data structures
     interiorFaces_.clear();
     boundaryFaces_.clear();
+    localInteriorFaces_.clear();
+    bufferFaces_.clear();
 
     //- User defined face groups and patches
     faceGroups_.clear();
@@ -242,12 +254,14 @@ void FiniteVolumeGrid2D::setCellActive(const Cell &cell)
 {
     localActiveCells_.add(cell);
     globalActiveCells_.add(cell);
+    activeCellsChanged_ = true;
 }
 
 void FiniteVolumeGrid2D::setCellInactive(const Cell& cell)
 {
     localInactiveCells_.add(cell);
     globalInactiveCells_.add(cell);
+    activeCellsChanged_ = true;
 }
 
 CellGroup FiniteVolumeGrid2D::globalCellGroup(const CellGroup &localGroup) const
@@ -446,7 +460,7 @@ void FiniteVolumeGrid2D::partition(const Input &input, std::shared_ptr<Communica
     comm_->printf("Computing the local cell domains...\n");
     vector<Point2D> nodes;
     vector<Label> cellInds(1, 0), cellNodeIds, cellProc;
-    unordered_map<Label, Label> cellGlobalToLocalIdMap, cellLocalToGlobalIdMap;
+    unordered_map<Label, Label> cellLocalToGlobalIdMap;
     vector<int> localNodeId(nodes_.size(), -1);
     Scalar r = input.caseInput().get<Scalar>("Grid.minBufferWidth", 0.); //- May be important for algorithms requiring spatial searches
 
@@ -457,7 +471,6 @@ void FiniteVolumeGrid2D::partition(const Input &input, std::shared_ptr<Communica
             cellInds.push_back(cellInds.back() + cell.nodes().size());
             cellProc.push_back(cellPartition[cell.id()]);
 
-            cellGlobalToLocalIdMap[cell.id()] = cellInds.size() - 2;
             cellLocalToGlobalIdMap[cellInds.size() - 2] = cell.id();
 
             for(const Node& node: cell.nodes())
@@ -507,44 +520,81 @@ void FiniteVolumeGrid2D::partition(const Input &input, std::shared_ptr<Communica
 
     //- Interprocess communication zones
     comm_->printf("Initializing interprocess communication buffers...\n");
-    sendCellGroups_.resize(comm_->nProcs());
-    bufferCellZones_.resize(comm_->nProcs());
+    vector<Label> globalIds(nCells());
+    for(const Cell& cell: cells_)
+        globalIds[cell.id()] = cellLocalToGlobalIdMap[cell.id()];
 
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
+    initCommunication(vector<int>(cellProc.begin(), cellProc.end()), globalIds);
+    computeGlobalOrdering();
+}
+
+void FiniteVolumeGrid2D::initCommunication(const std::vector<int> &procNo, const std::vector<Label> &globalIds)
+{
+    //- Buffer relationships are symmetric, a proc owning buffer cells here will also require cells from this proc
+    std::map<int, int> neighbourNo;
+    for (const Cell &cell: cells_)
+        if (procNo[cell.id()] != comm_->rank())
+            neighbourNo.insert(std::make_pair(procNo[cell.id()], 0));
+
+    neighbourProcs_.clear();
+    for (auto &neighbour: neighbourNo)
+    {
+        neighbour.second = neighbourProcs_.size();
+        neighbourProcs_.push_back(neighbour.first);
+    }
+
+    //- Zones must be sized before they are populated since they register themselves by reference
+    sendCellGroups_.resize(neighbourProcs_.size());
+    bufferCellZones_.resize(neighbourProcs_.size());
+
+    for (int i = 0; i < neighbourProcs_.size(); ++i)
     {
-        sendCellGroups_[proc] = CellGroup("Proc" + std::to_string(proc));
-        bufferCellZones_[proc] = CellZone("Proc" + std::to_string(proc), localActiveCells_.registry());
+        sendCellGroups_[i] = CellGroup("Proc" + std::to_string(neighbourProcs_[i]));
+        bufferCellZones_[i] = CellZone("Proc" + std::to_string(neighbourProcs_[i]), localActiveCells_.registry());
     }
 
     //- Identify buffer regions
-    for(const Cell& cell: cells_)
-        if(cellProc[cell.id()] != comm_->rank())
-            bufferCellZones_[cellProc[cell.id()]].add(cell);
+    for (const Cell &cell: cells_)
+        if (procNo[cell.id()] != comm_->rank())
+            bufferCellZones_[neighbourNo[procNo[cell.id()]]].add(cell);
 
-    //- Initialize all buffers
-    std::vector<std::vector<unsigned long>> recvOrders(comm_->nProcs());
+    //- Communicate send orders to neighbours only
+    std::unordered_map<Label, Label> globalToLocalIdMap;
+    for (Label id = 0; id < globalIds.size(); ++id)
+        globalToLocalIdMap[globalIds[id]] = id;
 
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
+    std::vector<std::vector<unsigned long>> recvOrders(neighbourProcs_.size());
+    for (int i = 0; i < neighbourProcs_.size(); ++i)
     {
-        std::transform(bufferCellZones_[proc].begin(), bufferCellZones_[proc].end(),
-                       std::back_inserter(recvOrders[proc]), [&cellLocalToGlobalIdMap](const Cell &cell) {
-                    return cellLocalToGlobalIdMap[cell.id()];
+        std::transform(bufferCellZones_[i].begin(), bufferCellZones_[i].end(),
+                       std::back_inserter(recvOrders[i]), [&globalIds](const Cell &cell) {
+                    return globalIds[cell.id()];
                 });
 
-        comm_->isend(proc, recvOrders[proc], proc);
+        comm_->isend(neighbourProcs_[i], recvOrders[i], neighbourProcs_[i]);
     }
 
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
+    for (int i = 0; i < neighbourProcs_.size(); ++i)
     {
-        std::vector<unsigned long> sendOrder(comm_->probeSize<unsigned long>(proc, comm_->rank()));
-        comm_->recv(proc, sendOrder, comm_->rank());
+        std::vector<unsigned long> sendOrder(comm_->probeSize<unsigned long>(neighbourProcs_[i], comm_->rank()));
+        comm_->recv(neighbourProcs_[i], sendOrder, comm_->rank());
 
-        for(Label gid: sendOrder)
-            sendCellGroups_[proc].add(cells_[cellGlobalToLocalIdMap[gid]]);
+        for (Label gid: sendOrder)
+            sendCellGroups_[i].add(cells_[globalToLocalIdMap[gid]]);
     }
 
     comm_->waitAll();
-    computeGlobalOrdering();
+
+    //- Graph communicator for neighbourhood collectives
+    neighbourComm_ = comm_->createNeighbourhood(neighbourProcs_);
+
+    //- Neighbours on the same node can read buffer cell values directly from shared memory
+    sharedMemoryComm_ = comm_->createSharedMemoryComm();
+    neighbourSharedRanks_ = comm_->translateRanks(neighbourProcs_, *sharedMemoryComm_);
+
+    classifyInteriorFaces();
+
+    ++geometryVersion_;
 }
 
 void FiniteVolumeGrid2D::computeGlobalOrdering()
@@ -556,11 +606,8 @@ void FiniteVolumeGrid2D::computeGlobalOrdering()
     Index globalIndexStart = std::accumulate(nLocalCells.begin(), nLocalCells.begin() + comm_->rank(), 0);
     nActiveCellsGlobal_ = std::accumulate(nLocalCells.begin(), nLocalCells.end(), 0);
 
-    std::vector<Index> globalIndices[] = {
-            std::vector<Index>(nCells(), -1),
-            std::vector<Index>(nCells(), -1),
-            std::vector<Index>(nCells(), -1),
-    };
+    //- The scalar, vector x and vector y indices are stored as consecutive sets of nCells entries
+    std::vector<Index> globalIndices(3 * nCells(), -1);
 
     Index localIndex = 0;
     for (const Cell &cell: localActiveCells_)
@@ -572,15 +619,14 @@ void FiniteVolumeGrid2D::computeGlobalOrdering()
         cells_[cell.id()].index(3) = 2 * globalIndexStart + localIndex + nLocalCells[comm_->rank()];
         ++localIndex;
 
-        globalIndices[0][cell.id()] = cell.index(1);
-        globalIndices[1][cell.id()] = cell.index(2);
-        globalIndices[2][cell.id()] = cell.index(3);
+        globalIndices[cell.id()] = cell.index(1);
+        globalIndices[cell.id() + nCells()] = cell.index(2);
+        globalIndices[cell.id() + 2 * nCells()] = cell.index(3);
     }
 
-    //- Must communicate new global indices to neighbours
-    sendMessages(globalIndices[0]);
-    sendMessages(globalIndices[1]);
-    sendMessages(globalIndices[2]);
+    //- Must communicate new global indices to neighbours. This runs whenever the active cells change, so the
+    //- messages are sent directly rather than through a halo exchange, which would allocate a shared window
+    sendMessages(globalIndices, 3);
 
     //- Set global ids for the buffer zones
     for (CellZone &bufferZone: bufferCellZones_)
@@ -588,21 +634,38 @@ void FiniteVolumeGrid2D::computeGlobalOrdering()
         {
             cells_[cell.id()].setNumIndices(4);
             cells_[cell.id()].index(0) = -1;
-            cells_[cell.id()].index(1) = globalIndices[0][cell.id()];
-            cells_[cell.id()].index(2) = globalIndices[1][cell.id()];
-            cells_[cell.id()].index(3) = globalIndices[2][cell.id()];
+            cells_[cell.id()].index(1) = globalIndices[cell.id()];
+            cells_[cell.id()].index(2) = globalIndices[cell.id() + nCells()];
+            cells_[cell.id()].index(3) = globalIndices[cell.id() + 2 * nCells()];
 
-            if(globalIndices[0][cell.id()] != -1)
+            if(globalIndices[cell.id()] != -1)
                 globalActiveCells_.add(cell);
             else
                 globalInactiveCells_.add(cell);
         }
 
+    classifyLocalActiveCells();
+
+    activeCellsChanged_ = false;
+    ++topologyVersion_;
+
     comm_->printf("Num local cells main proc = %d\nNum global cells = %d\n",
                   nLocalCells[comm_->rank()],
                   nActiveCellsGlobal_);
 }
 
+bool FiniteVolumeGrid2D::updateGlobalOrdering(bool cellsChanged)
+{
+    unsigned long nChanged = cellsChanged || activeCellsChanged_ ? 1 : 0;
+
+    //- The ordering is global, so every proc must agree on whether to recompute it
+    if (comm_->sum(nChanged) == 0)
+        return false;
+
+    computeGlobalOrdering();
+    return true;
+}
+
 void FiniteVolumeGrid2D::computeParMetisGlobalOrdering()
 {
 
@@ -663,6 +726,10 @@ void FiniteVolumeGrid2D::initCells()
     }
 
     setCellsActive(cells_.begin(), cells_.end());
+
+    //- No buffer zones exist yet, everything is local
+    classifyInteriorFaces();
+    classifyLocalActiveCells();
 }
 
 void FiniteVolumeGrid2D::initConnectivity()
@@ -675,3 +742,49 @@ void FiniteVolumeGrid2D::computeBoundingBox()
 {
     bBox_ = BoundingBox(nodes_.data(), nodes_.size());
 }
+
+void FiniteVolumeGrid2D::classifyLocalActiveCells()
+{
+    std::vector<bool> isBufferCell(nCells(), false);
+    for (const CellZone &bufferZone: bufferCellZones_)
+        for (const Cell &cell: bufferZone)
+            isBufferCell[cell.id()] = true;
+
+    auto requiresBuffer = [&isBufferCell](const Cell &cell) {
+        for (const InteriorLink &nb: cell.neighbours())
+            if (isBufferCell[nb.cell().id()])
+                return true;
+
+        for (const CellLink &dg: cell.diagonals())
+            if (isBufferCell[dg.cell().id()])
+                return true;
+
+        return false;
+    };
+
+    localInteriorCells_.clear();
+    localBoundaryCells_.clear();
+
+    for (const Cell &cell: localActiveCells_)
+        if (requiresBuffer(cell))
+            localBoundaryCells_.add(cell);
+        else
+            localInteriorCells_.add(cell);
+}
+
+void FiniteVolumeGrid2D::classifyInteriorFaces()
+{
+    std::vector<bool> isBufferCell(nCells(), false);
+    for (const CellZone &bufferZone: bufferCellZones_)
+        for (const Cell &cell: bufferZone)
+            isBufferCell[cell.id()] = true;
+
+    localInteriorFaces_.clear();
+    bufferFaces_.clear();
+
+    for (const Face &face: interiorFaces_)
+        if (isBufferCell[face.lCell().id()] || isBufferCell[face.rCell().id()])
+            bufferFaces_.add(face);
+        else
+            localInteriorFaces_.add(face);
+}
@@ -48,6 +48,15 @@ public:
     Size nActiveCellsGlobal() const
     { return nActiveCellsGlobal_; }
 
+    //- Incremented each time the global ordering is recomputed
+    Size topologyVersion() const
+    { return topologyVersion_; }
+
+    //- Incremented each time the cells or the buffer zones are rebuilt, unlike the topology version it does not
+    //- change with the active cells
+    Size geometryVersion() const
+    { return geometryVersion_; }
+
     std::string gridInfo() const;
 
     //- Create grid entities
@@ -95,6 +104,7 @@ public:
     {
         localActiveCells_.add(begin, end);
         globalActiveCells_.add(begin, end);
+        activeCellsChanged_ = true;
     }
 
     void setCellInactive(const Cell &cell);
@@ -149,9 +159,21 @@ public:
     const CellZone &globalInactiveCells() const
     { return globalInactiveCells_; }
 
+    //- Communication zones, indexed by neighbour number
+    const std::vector<CellGroup> &sendGroups() const
+    { return sendCellGroups_; }
+
     const std::vector<CellZone> &bufferZones() const
     { return bufferCellZones_; }
 
+    //- Local active cells with no neighbours or diagonals in a buffer zone
+    const CellGroup &localInteriorCells() const
+    { return localInteriorCells_; }
+
+    //- Local active cells that require buffer zone data
+    const CellGroup &localBoundaryCells() const
+    { return localBoundaryCells_; }
+
     //- Face related methods
 
     std::vector<Face> &faces()
@@ -166,6 +188,14 @@ public:
     const FaceGroup& boundaryFaces() const
     { return boundaryFaces_; }
 
+    //- Interior faces not adjacent to a buffer zone
+    const FaceGroup& localInteriorFaces() const
+    { return localInteriorFaces_; }
+
+    //- Interior faces adjacent to a buffer zone
+    const FaceGroup& bufferFaces() const
+    { return bufferFaces_; }
+
     bool faceExists(Label n1, Label n2) const;
 
     Label findFace(Label n1, Label n2) const;
@@ -208,6 +238,21 @@ public:
     const Communicator &comm() const
     { return *comm_; }
 
+    //- Graph communicator connecting only neighbouring procs, null if the grid is not partitioned
+    const std::shared_ptr<Communicator> &neighbourComm() const
+    { return neighbourComm_; }
+
+    const std::vector<int> &neighbourProcs() const
+    { return neighbourProcs_; }
+
+    //- Procs sharing memory with this proc, null if the grid is not partitioned
+    const std::shared_ptr<Communicator> &sharedMemoryComm() const
+    { return sharedMemoryComm_; }
+
+    //- Rank of each neighbour within the shared memory communicator, MPI_UNDEFINED if off-node
+    const std::vector<int> &neighbourSharedRanks() const
+    { return neighbourSharedRanks_; }
+
     std::pair<std::vector<int>, std::vector<int>> nodeElementConnectivity() const;
 
     void partition(const Input &input, std::shared_ptr<Communicator> comm);
@@ -221,6 +266,9 @@ public:
     //- Active cell ordering, required for lineary algebra!
     void computeGlobalOrdering();
 
+    //- Recomputes the ordering only if the active cells changed on any proc. Returns true if it was recomputed
+    bool updateGlobalOrdering(bool cellsChanged = false);
+
     void computeParMetisGlobalOrdering();
 
     //- Misc
@@ -237,6 +285,13 @@ protected:
 
     void computeBoundingBox();
 
+    void initCommunication(const std::vector<int> &procNo, const std::vector<Label> &globalIds);
+
+    //- Classify cells/faces for overlapping computation with communication
+    void classifyLocalActiveCells();
+
+    void classifyInteriorFaces();
+
     //- Node related data
     std::vector<Node> nodes_;
     NodeGroup interiorNodes_;
@@ -245,6 +300,8 @@ protected:
     //- Cell related data
     std::vector<Cell> cells_;
     Size nActiveCellsGlobal_;
+    Size topologyVersion_ = 0, geometryVersion_ = 0;
+    bool activeCellsChanged_ = true;
 
     //- Local cell zones
     CellZone localActiveCells_, localInactiveCells_;
@@ -258,9 +315,11 @@ protected:
     std::unordered_map<std::string, std::shared_ptr<CellZone>> cellZones_;
 
     //- Communication zones
-    std::shared_ptr<Communicator> comm_;
+    std::shared_ptr<Communicator> comm_, neighbourComm_, sharedMemoryComm_;
+    std::vector<int> neighbourProcs_, neighbourSharedRanks_;
     std::vector<CellGroup> sendCellGroups_;
     std::vector<CellZone> bufferCellZones_;
+    CellGroup localInteriorCells_, localBoundaryCells_;
 
     //- Face related data
     std::vector<Face> faces_;
@@ -269,6 +328,7 @@ protected:
     //- Interior and boundary face data structures
     FaceGroup interiorFaces_;
     FaceGroup boundaryFaces_;
+    FaceGroup localInteriorFaces_, bufferFaces_;
 
     //- User defined face groups and patches
     std::shared_ptr<Patch::PatchRegistry> patchRegistry_;
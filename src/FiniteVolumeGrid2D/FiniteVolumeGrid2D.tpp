@@ -6,45 +6,45 @@ void FiniteVolumeGrid2D::sendMessages(std::vector<T> &data) const
     if(!comm_ || comm_->nProcs() == 1)
         return;
 
-    std::vector<std::vector<T>> recvBuffers(comm_->nProcs());
+    std::vector<std::vector<T>> recvBuffers(neighbourProcs_.size());
 
     //- Post recvs first (non-blocking)
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
+    for(int i = 0; i < neighbourProcs_.size(); ++i)
     {
-        if(bufferCellZones_[proc].empty())
+        if(bufferCellZones_[i].empty())
             continue;
 
-        recvBuffers[proc].resize(bufferCellZones_[proc].size());
-        comm_->irecv(proc, recvBuffers[proc], proc);
+        recvBuffers[i].resize(bufferCellZones_[i].size());
+        comm_->irecv(neighbourProcs_[i], recvBuffers[i], neighbourProcs_[i]);
     }
 
     //- Send data (blocking sends)
     std::vector<T> sendBuffer;
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
+    for(int i = 0; i < neighbourProcs_.size(); ++i)
     {
-        if(sendCellGroups_[proc].empty())
+        if(sendCellGroups_[i].empty())
             continue;
 
-        sendBuffer.resize(sendCellGroups_[proc].size());
+        sendBuffer.resize(sendCellGroups_[i].size());
 
-        std::transform(sendCellGroups_[proc].begin(),
-                       sendCellGroups_[proc].end(),
+        std::transform(sendCellGroups_[i].begin(),
+                       sendCellGroups_[i].end(),
                        sendBuffer.begin(),
                        [&data](const Cell& cell) { return data[cell.id()]; });
 
-        comm_->ssend(proc, sendBuffer, comm_->rank());
+        comm_->ssend(neighbourProcs_[i], sendBuffer, comm_->rank());
     }
     comm_->waitAll();
 
     //- Unload recv buffers
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
+    for(int i = 0; i < neighbourProcs_.size(); ++i)
     {
-        if(recvBuffers[proc].empty())
+        if(recvBuffers[i].empty())
             continue;
 
-        int i = 0;
-        for(const Cell& cell: bufferCellZones_[proc])
-            data[cell.id()] = recvBuffers[proc][i++];
+        int j = 0;
+        for(const Cell& cell: bufferCellZones_[i])
+            data[cell.id()] = recvBuffers[i][j++];
     }
 }
 
@@ -54,45 +54,45 @@ void FiniteVolumeGrid2D::sendMessages(std::vector<T> &data, Size nSets) const
     if(!comm_ || comm_->nProcs() == 1)
         return;
 
-    std::vector<std::vector<T>> recvBuffers(comm_->nProcs());
+    std::vector<std::vector<T>> recvBuffers(neighbourProcs_.size());
 
     //- Post recvs first (non-blocking)
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
+    for(int i = 0; i < neighbourProcs_.size(); ++i)
     {
-        if(bufferCellZones_[proc].empty())
+        if(bufferCellZones_[i].empty())
             continue;
 
-        recvBuffers[proc].resize(bufferCellZones_[proc].size() * nSets);
-        comm_->irecv(proc, recvBuffers[proc], proc);
+        recvBuffers[i].resize(bufferCellZones_[i].size() * nSets);
+        comm_->irecv(neighbourProcs_[i], recvBuffers[i], neighbourProcs_[i]);
     }
 
     //- Send data (blocking sends)
     std::vector<T> sendBuffer;
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
+    for(int i = 0; i < neighbourProcs_.size(); ++i)
     {
-        if(sendCellGroups_[proc].empty())
+        if(sendCellGroups_[i].empty())
             continue;
 
-        sendBuffer.resize(sendCellGroups_[proc].size() * nSets);
+        sendBuffer.resize(sendCellGroups_[i].size() * nSets);
 
-        Size i = 0;
+        Size j = 0;
         for(Size set = 0; set < nSets; ++set)
-            for(const Cell& cell: sendCellGroups_[proc])
-                sendBuffer[i++] = data[cell.id() + set * nCells()];
+            for(const Cell& cell: sendCellGroups_[i])
+                sendBuffer[j++] = data[cell.id() + set * nCells()];
 
-        comm_->ssend(proc, sendBuffer, comm_->rank());
+        comm_->ssend(neighbourProcs_[i], sendBuffer, comm_->rank());
     }
     comm_->waitAll();
 
     //- Unload recv buffers
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
+    for(int i = 0; i < neighbourProcs_.size(); ++i)
     {
-        if(recvBuffers[proc].empty())
+        if(recvBuffers[i].empty())
             continue;
 
-        int i = 0;
+        int j = 0;
         for(Size set = 0; set < nSets; ++set)
-            for(const Cell& cell: bufferCellZones_[proc])
-                data[cell.id() + set * nCells()] = recvBuffers[proc][i++];
+            for(const Cell& cell: bufferCellZones_[i])
+                data[cell.id() + set * nCells()] = recvBuffers[i][j++];
     }
 }
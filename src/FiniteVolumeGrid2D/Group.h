@@ -52,6 +52,7 @@ public:
 
     virtual void remove(const T &item);
 
+    //- Removes all items of other in a single pass over this group
     virtual void remove(const Group<T> &other);
 
     Group<T> &operator+=(const Group<T> &rhs);
@@ -34,8 +34,26 @@ void Group<T>::remove(const T &item)
 template<class T>
 void Group<T>::remove(const Group<T> &other)
 {
+    if (this == &other)
+    {
+        clear();
+        return;
+    }
+
+    Size nRemoved = 0;
+
     for (const T &item: other)
-        remove(item);
+        if (itemSet_.erase(item.id()))
+        {
+            rTree_.remove(Value(item.centroid(), item.id()));
+            ++nRemoved;
+        }
+
+    //- A single compaction pass instead of one per removed item
+    if (nRemoved > 0)
+        items_.erase(std::remove_if(items_.begin(), items_.end(),
+                                    [this](const T &i) { return itemSet_.find(i.id()) == itemSet_.end(); }),
+                     items_.end());
 }
 
 template<class T>
@@ -0,0 +1,307 @@
+#include "HaloExchange.h"
+#include "FiniteVolumeGrid2D.h"
+
+namespace
+{
+    inline void pack(int val, Scalar *&buffer)
+    { *(buffer++) = val; }
+
+    inline void pack(Scalar val, Scalar *&buffer)
+    { *(buffer++) = val; }
+
+    inline void pack(const Vector2D &val, Scalar *&buffer)
+    {
+        *(buffer++) = val.x;
+        *(buffer++) = val.y;
+    }
+
+    inline void pack(const Tensor2D &val, Scalar *&buffer)
+    {
+        *(buffer++) = val.xx;
+        *(buffer++) = val.xy;
+        *(buffer++) = val.yx;
+        *(buffer++) = val.yy;
+    }
+
+    inline void unpack(const Scalar *&buffer, int &val)
+    { val = (int) *(buffer++); }
+
+    inline void unpack(const Scalar *&buffer, Scalar &val)
+    { val = *(buffer++); }
+
+    inline void unpack(const Scalar *&buffer, Vector2D &val)
+    {
+        val.x = *(buffer++);
+        val.y = *(buffer++);
+    }
+
+    inline void unpack(const Scalar *&buffer, Tensor2D &val)
+    {
+        val.xx = *(buffer++);
+        val.xy = *(buffer++);
+        val.yx = *(buffer++);
+        val.yy = *(buffer++);
+    }
+
+    template<class T>
+    struct Components;
+
+    template<>
+    struct Components<int>
+    { enum {value = 1}; };
+
+    template<>
+    struct Components<Scalar>
+    { enum {value = 1}; };
+
+    template<>
+    struct Components<Vector2D>
+    { enum {value = 2}; };
+
+    template<>
+    struct Components<Tensor2D>
+    { enum {value = 4}; };
+}
+
+class HaloExchange::Field
+{
+public:
+
+    virtual ~Field()
+    {}
+
+    virtual Size nComponents() const = 0;
+
+    virtual void pack(const CellGroup &cells, Scalar *&buffer) const = 0;
+
+    virtual void unpack(const CellGroup &cells, const Scalar *&buffer) = 0;
+};
+
+template<class T>
+class HaloExchange::FieldData : public HaloExchange::Field
+{
+public:
+
+    FieldData(std::vector<T> &data) : data_(data)
+    {}
+
+    Size nComponents() const
+    { return Components<T>::value; }
+
+    void pack(const CellGroup &cells, Scalar *&buffer) const
+    {
+        for (const Cell &cell: cells)
+            ::pack(data_[cell.id()], buffer);
+    }
+
+    void unpack(const CellGroup &cells, const Scalar *&buffer)
+    {
+        for (const Cell &cell: cells)
+            ::unpack(buffer, data_[cell.id()]);
+    }
+
+private:
+
+    std::vector<T> &data_;
+};
+
+HaloExchange::HaloExchange(const FiniteVolumeGrid2D &grid)
+        :
+        grid_(grid)
+{
+
+}
+
+HaloExchange::~HaloExchange()
+{
+    if (!initialized_)
+        return;
+
+    finish();
+
+    int finalized;
+    MPI_Finalized(&finalized);
+
+    //- Every proc destroys its exchanges in the same order as it initialized them
+    if (window_ != MPI_WIN_NULL && !finalized)
+        grid_.sharedMemoryComm()->freeWindow(window_);
+}
+
+void HaloExchange::add(std::vector<int> &data)
+{
+    addField(new FieldData<int>(data));
+}
+
+void HaloExchange::add(std::vector<Scalar> &data)
+{
+    addField(new FieldData<Scalar>(data));
+}
+
+void HaloExchange::add(std::vector<Vector2D> &data)
+{
+    addField(new FieldData<Vector2D>(data));
+}
+
+void HaloExchange::add(std::vector<Tensor2D> &data)
+{
+    addField(new FieldData<Tensor2D>(data));
+}
+
+void HaloExchange::clear()
+{
+    if (initialized_)
+        throw Exception("HaloExchange", "clear", "cannot unregister fields after init.");
+
+    fields_.clear();
+    nComponents_ = 0;
+}
+
+void HaloExchange::init()
+{
+    if (initialized_)
+        throw Exception("HaloExchange", "init", "halo exchange is already initialized.");
+
+    initialized_ = true;
+
+    //- An unpartitioned grid has no buffer zones
+    if (!grid_.neighbourComm())
+        return;
+
+    Size nNeighbours = grid_.neighbourProcs().size();
+    sendCounts_.resize(nNeighbours);
+    sendDispls_.resize(nNeighbours);
+    recvCounts_.resize(nNeighbours);
+    recvDispls_.resize(nNeighbours);
+
+    int sendSize = 0, recvSize = 0;
+    for (int i = 0; i < nNeighbours; ++i)
+    {
+        sendCounts_[i] = grid_.sendGroups()[i].size() * nComponents_;
+        sendDispls_[i] = sendSize;
+        sendSize += sendCounts_[i];
+
+        recvCounts_[i] = grid_.bufferZones()[i].size() * nComponents_;
+        recvDispls_[i] = recvSize;
+        recvSize += recvCounts_[i];
+    }
+
+    sendBuffer_.resize(sendSize);
+    recvBuffer_.resize(recvSize);
+
+    //- Window allocation is collective over the node, every proc allocates even without on-node neighbours
+    if (grid_.sharedMemoryComm())
+    {
+        const Communicator &sharedComm = *grid_.sharedMemoryComm();
+        window_ = sharedComm.allocateSharedWindow(2 * sendSize, windowPtr_);
+
+        //- Offset of the block meant for this proc within each neighbour's segment of the window
+        std::vector<int> remoteDispls = grid_.neighbourComm()->neighbourAllToAll(sendDispls_);
+        sharedRecvPtrs_.assign(nNeighbours, nullptr);
+
+        for (int i = 0; i < nNeighbours; ++i)
+            if (isShared(i))
+            {
+                sharedRecvPtrs_[i] = sharedComm.sharedWindowPtr(window_, grid_.neighbourSharedRanks()[i])
+                                     + 2 * remoteDispls[i];
+                sendCounts_[i] = recvCounts_[i] = 0;
+            }
+    }
+}
+
+void HaloExchange::exchange()
+{
+    start();
+    finish();
+}
+
+void HaloExchange::start()
+{
+    if (!initialized_)
+        throw Exception("HaloExchange", "start", "halo exchange must be initialized before use.");
+
+    //- An unpartitioned grid has no buffer zones
+    if (inProgress_ || fields_.empty() || !grid_.neighbourComm())
+        return;
+
+    //- Pack all fields, field by field, into one contiguous block per neighbour
+    for (int i = 0; i < grid_.sendGroups().size(); ++i)
+    {
+        Scalar *buffer = sendBlock(i);
+        for (const auto &field: fields_)
+            field->pack(grid_.sendGroups()[i], buffer);
+    }
+
+    //- Neighbours on the same node are only notified that their block is ready, no data is sent
+    if (window_ != MPI_WIN_NULL)
+    {
+        grid_.sharedMemoryComm()->syncWindow(window_);
+
+        for (int i = 0; i < grid_.neighbourProcs().size(); ++i)
+            if (isShared(i))
+            {
+                signalRequests_.push_back(grid_.neighbourComm()->isignal(grid_.neighbourProcs()[i], 0));
+                signalRequests_.push_back(grid_.neighbourComm()->irecvSignal(grid_.neighbourProcs()[i], 0));
+            }
+    }
+
+    request_ = grid_.neighbourComm()->ineighbourAllToAllv(sendBuffer_, sendCounts_, sendDispls_,
+                                                           recvBuffer_, recvCounts_, recvDispls_);
+    inProgress_ = true;
+}
+
+void HaloExchange::finish()
+{
+    if (!inProgress_)
+        return;
+
+    grid_.neighbourComm()->wait(request_);
+    inProgress_ = false;
+
+    if (window_ != MPI_WIN_NULL)
+    {
+        grid_.neighbourComm()->waitAll(signalRequests_);
+        grid_.sharedMemoryComm()->syncWindow(window_);
+    }
+
+    //- Unload recv buffer
+    for (int i = 0; i < grid_.bufferZones().size(); ++i)
+    {
+        const Scalar *buffer = recvBlock(i);
+        for (const auto &field: fields_)
+            field->unpack(grid_.bufferZones()[i], buffer);
+    }
+
+    slot_ = 1 - slot_;
+}
+
+//- Private methods
+
+void HaloExchange::addField(Field *field)
+{
+    if (initialized_)
+        throw Exception("HaloExchange", "add", "cannot register fields after init.");
+
+    fields_.push_back(std::unique_ptr<Field>(field));
+    nComponents_ += field->nComponents();
+}
+
+bool HaloExchange::isShared(int neighbourNo) const
+{
+    return window_ != MPI_WIN_NULL && grid_.neighbourSharedRanks()[neighbourNo] != MPI_UNDEFINED;
+}
+
+Scalar *HaloExchange::sendBlock(int neighbourNo)
+{
+    if (!isShared(neighbourNo))
+        return sendBuffer_.data() + sendDispls_[neighbourNo];
+
+    return windowPtr_ + 2 * sendDispls_[neighbourNo] + slot_ * grid_.sendGroups()[neighbourNo].size() * nComponents_;
+}
+
+const Scalar *HaloExchange::recvBlock(int neighbourNo) const
+{
+    if (!isShared(neighbourNo))
+        return recvBuffer_.data() + recvDispls_[neighbourNo];
+
+    return sharedRecvPtrs_[neighbourNo] + slot_ * grid_.bufferZones()[neighbourNo].size() * nComponents_;
+}
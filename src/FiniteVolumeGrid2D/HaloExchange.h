@@ -0,0 +1,92 @@
+#ifndef HALO_EXCHANGE_H
+#define HALO_EXCHANGE_H
+
+#include <memory>
+
+#include "CellGroup.h"
+#include "Communicator.h"
+
+class FiniteVolumeGrid2D;
+
+class HaloExchange
+{
+public:
+
+    HaloExchange(const FiniteVolumeGrid2D &grid);
+
+    //- Owns an MPI window, which must be freed exactly once
+    HaloExchange(const HaloExchange &) = delete;
+
+    HaloExchange &operator=(const HaloExchange &) = delete;
+
+    ~HaloExchange();
+
+    //- Field registration. All registered fields are packed into a single block per neighbour. Fields can
+    //- only be registered before init
+    void add(std::vector<int> &data);
+
+    void add(std::vector<Scalar> &data);
+
+    void add(std::vector<Vector2D> &data);
+
+    void add(std::vector<Tensor2D> &data);
+
+    void clear();
+
+    //- Allocate the communication buffers. Collective over all procs of the grid, so it must be called
+    //- unconditionally, usually from the constructor of the owner once all fields are registered
+    void init();
+
+    bool initialized() const
+    { return initialized_; }
+
+    Size nFields() const
+    { return fields_.size(); }
+
+    //- Update the buffer cells of all registered fields
+    void exchange();
+
+    //- Split exchange, work not depending on buffer cells can be done in between
+    void start();
+
+    void finish();
+
+    bool inProgress() const
+    { return inProgress_; }
+
+private:
+
+    class Field;
+
+    template<class T>
+    class FieldData;
+
+    void addField(Field *field);
+
+    bool isShared(int neighbourNo) const;
+
+    Scalar *sendBlock(int neighbourNo);
+
+    const Scalar *recvBlock(int neighbourNo) const;
+
+    const FiniteVolumeGrid2D &grid_;
+
+    std::vector<std::unique_ptr<Field>> fields_;
+    Size nComponents_ = 0;
+
+    //- Communication buffers, sized by neighbour count on init
+    bool initialized_ = false, inProgress_ = false;
+    std::vector<int> sendCounts_, sendDispls_, recvCounts_, recvDispls_;
+    std::vector<Scalar> sendBuffer_, recvBuffer_;
+    MPI_Request request_;
+
+    //- Shared memory window for neighbours on the same node. Each send block is double buffered, so a block
+    //- is never overwritten before the neighbour has signalled that it finished reading the previous one
+    MPI_Win window_ = MPI_WIN_NULL;
+    Scalar *windowPtr_ = nullptr;
+    std::vector<const Scalar*> sharedRecvPtrs_;
+    std::vector<MPI_Request> signalRequests_;
+    int slot_ = 0;
+};
+
+#endif
@@ -0,0 +1,246 @@
+#include <math.h>
+#include <limits>
+#include <algorithm>
+
+#include "SignedDistanceField.h"
+#include "Exception.h"
+
+namespace
+{
+    Point2D projection(const LineSegment2D &edge, const Point2D &pt)
+    {
+        if (edge.isBounded(pt))
+        {
+            Vector2D t = edge.rVec();
+            return edge.ptA() + dot(pt - edge.ptA(), t) * t / t.magSqr();
+        }
+
+        return (edge.ptA() - pt).magSqr() < (edge.ptB() - pt).magSqr() ? edge.ptA() : edge.ptB();
+    }
+}
+
+SignedDistanceField::SignedDistanceField(const Polygon &pgn, Scalar spacing, Scalar band)
+        :
+        center_(pgn.centroid()),
+        theta_(0.),
+        h_(spacing)
+{
+    if (spacing <= 0. || band < 0.)
+        throw Exception("SignedDistanceField", "SignedDistanceField", "spacing must be positive and band non-negative.");
+
+    if (pgn.vertices().size() < 3)
+        throw Exception("SignedDistanceField", "SignedDistanceField", "polygon has no edges.");
+
+    std::vector<Point2D> verts;
+    verts.reserve(pgn.vertices().size());
+
+    for (const Point2D &vtx: pgn.vertices())
+        verts.push_back(vtx - center_);
+
+    ref_ = Polygon(verts.begin(), verts.end());
+    refEdge_ = ref_.vertices()[1] - ref_.vertices()[0];
+
+    auto box = ref_.boundingBox();
+
+    origin_ = box.min_corner() - Vector2D(band, band);
+    nx_ = (int) std::ceil((box.max_corner().x - box.min_corner().x + 2. * band) / h_) + 1;
+    ny_ = (int) std::ceil((box.max_corner().y - box.min_corner().y + 2. * band) / h_) + 1;
+
+    phi_.resize(nx_ * ny_);
+
+    std::vector<LineSegment2D> edges = ref_.edges();
+    std::vector<std::vector<Label>> candidates(nx_ * ny_);
+
+    //- Setup is a brute force search, queries are not. A point within a lattice cell is at most h sqrt(2) from
+    //- a node, so its nearest edge is within |phi| + 2 h sqrt(2) of that node
+#pragma omp parallel for
+    for (int j = 0; j < ny_; ++j)
+        for (int i = 0; i < nx_; ++i)
+        {
+            Point2D pt = nodePoint(i, j);
+            std::vector<Scalar> dist(edges.size());
+
+            for (Label k = 0; k < edges.size(); ++k)
+                dist[k] = (projection(edges[k], pt) - pt).mag();
+
+            Scalar minDist = *std::min_element(dist.begin(), dist.end());
+            Scalar maxDist = minDist + 2. * std::sqrt(2.) * h_;
+
+            for (Label k = 0; k < edges.size(); ++k)
+                if (dist[k] <= maxDist)
+                    candidates[node(i, j)].push_back(k);
+
+            phi_[node(i, j)] = ref_.isInside(pt) ? -minDist : minDist;
+        }
+
+    candidateStart_.resize(nx_ * ny_ + 1, 0);
+
+    for (Label n = 0; n < candidates.size(); ++n)
+        candidateStart_[n + 1] = candidateStart_[n] + candidates[n].size();
+
+    candidateIds_.reserve(candidateStart_.back());
+
+    for (const auto &ids: candidates)
+        candidateIds_.insert(candidateIds_.end(), ids.begin(), ids.end());
+}
+
+void SignedDistanceField::setPose(const Polygon &pgn)
+{
+    center_ = pgn.centroid();
+    theta_ = (pgn.vertices()[1] - pgn.vertices()[0]).angle(refEdge_);
+}
+
+bool SignedDistanceField::isInside(const Point2D &pt) const
+{
+    Point2D p = toBody(pt);
+
+    if (!inLattice(p))
+        return false;
+
+    auto ij = latticeCell(p);
+    int i = ij.first + (p.x - nodePoint(ij.first, ij.second).x > h_ / 2. ? 1 : 0);
+    int j = ij.second + (p.y - nodePoint(ij.first, ij.second).y > h_ / 2. ? 1 : 0);
+
+    //- The distance is 1-Lipschitz, so the sign of the nearest node holds if the node is further from the surface
+    Scalar phi = phi_[node(i, j)];
+
+    if (std::abs(phi) > (p - nodePoint(i, j)).mag())
+        return phi < 0.;
+
+    return ref_.isInside(p);
+}
+
+Scalar SignedDistanceField::distance(const Point2D &pt) const
+{
+    Point2D p = toBody(pt);
+
+    if (!inLattice(p))
+        return (ref_.nearestIntersect(p) - p).mag();
+
+    auto ij = latticeCell(p);
+    int i = ij.first, j = ij.second;
+    Scalar s = (p.x - nodePoint(i, j).x) / h_;
+    Scalar t = (p.y - nodePoint(i, j).y) / h_;
+
+    return (1. - s) * (1. - t) * phi_[node(i, j)] + s * (1. - t) * phi_[node(i + 1, j)]
+           + (1. - s) * t * phi_[node(i, j + 1)] + s * t * phi_[node(i + 1, j + 1)];
+}
+
+Point2D SignedDistanceField::nearestIntersect(const Point2D &pt) const
+{
+    Point2D p = toBody(pt);
+
+    if (!inLattice(p))
+        return toWorld(ref_.nearestIntersect(p));
+
+    Label k = nearestEdgeId(p);
+    return toWorld(projection(LineSegment2D(ref_.vertices()[k], ref_.vertices()[k + 1]), p));
+}
+
+LineSegment2D SignedDistanceField::nearestEdge(const Point2D &pt) const
+{
+    Point2D p = toBody(pt);
+
+    if (!inLattice(p))
+    {
+        LineSegment2D edge = ref_.nearestEdge(p);
+        return LineSegment2D(toWorld(edge.ptA()), toWorld(edge.ptB()));
+    }
+
+    Label k = nearestEdgeId(p);
+    return LineSegment2D(toWorld(ref_.vertices()[k]), toWorld(ref_.vertices()[k + 1]));
+}
+
+Point2D SignedDistanceField::intersection(const Ray2D &ray) const
+{
+    //- Steps follow the distance to the surface, capped so that the walk cannot step over a body thinner than the
+    //- lattice. The ray is outside the lattice for good once it is further than the lattice diagonal from the body
+    Scalar sign = distance(ray.x0()) < 0. ? -1. : 1.;
+    Scalar tMax = (ray.x0() - center_).mag() + h_ * std::sqrt(Scalar((nx_ - 1) * (nx_ - 1) + (ny_ - 1) * (ny_ - 1)));
+    Scalar t0 = 0., t1 = 0.;
+
+    while (true)
+    {
+        Scalar d = sign * distance(ray(t1));
+
+        if (d <= 0.)
+            break;
+
+        if (t1 > tMax)
+            throw Exception("SignedDistanceField", "intersection", "ray does not intersect the polygon.");
+
+        t0 = t1;
+        t1 += std::min(std::max(d, h_ / 4.), h_ / 2.);
+    }
+
+    //- Bisect the bracket down to a small fraction of the lattice spacing
+    while (t1 - t0 > 1e-6 * h_)
+    {
+        Scalar t = (t0 + t1) / 2.;
+
+        if (sign * distance(ray(t)) > 0.)
+            t0 = t;
+        else
+            t1 = t;
+    }
+
+    //- The interpolated field is not exact near the surface, so the crossing is snapped to the line of the nearest edge
+    LineSegment2D edge = nearestEdge(ray(t1));
+    Scalar det = cross(ray.r(), -edge.rVec());
+
+    if (det != 0.)
+    {
+        Scalar t = cross(edge.ptA() - ray.x0(), -edge.rVec()) / det;
+
+        if (std::abs(t - t1) <= h_)
+            return ray(t);
+    }
+
+    return ray(t1);
+}
+
+//- Private methods
+
+bool SignedDistanceField::inLattice(const Point2D &pt) const
+{
+    return pt.x >= origin_.x && pt.x <= origin_.x + (nx_ - 1) * h_
+           && pt.y >= origin_.y && pt.y <= origin_.y + (ny_ - 1) * h_;
+}
+
+std::pair<int, int> SignedDistanceField::latticeCell(const Point2D &pt) const
+{
+    int i = std::min(std::max((int) std::floor((pt.x - origin_.x) / h_), 0), nx_ - 2);
+    int j = std::min(std::max((int) std::floor((pt.y - origin_.y) / h_), 0), ny_ - 2);
+    return std::make_pair(i, j);
+}
+
+Label SignedDistanceField::nearestEdgeId(const Point2D &pt) const
+{
+    auto ij = latticeCell(pt);
+
+    //- Any node of the cell holds every candidate, the shortest list is searched
+    Label n = node(ij.first, ij.second);
+
+    for (int j = ij.second; j < ij.second + 2; ++j)
+        for (int i = ij.first; i < ij.first + 2; ++i)
+            if (candidateStart_[node(i, j) + 1] - candidateStart_[node(i, j)] < candidateStart_[n + 1] - candidateStart_[n])
+                n = node(i, j);
+
+    Scalar minDistSqr = std::numeric_limits<Scalar>::infinity();
+    Label minId = 0;
+
+    for (Label c = candidateStart_[n]; c < candidateStart_[n + 1]; ++c)
+    {
+        Label k = candidateIds_[c];
+        LineSegment2D edge(ref_.vertices()[k], ref_.vertices()[k + 1]);
+        Scalar distSqr = (projection(edge, pt) - pt).magSqr();
+
+        if (distSqr < minDistSqr)
+        {
+            minDistSqr = distSqr;
+            minId = k;
+        }
+    }
+
+    return minId;
+}
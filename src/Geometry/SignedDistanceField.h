@@ -0,0 +1,70 @@
+#ifndef SIGNED_DISTANCE_FIELD_H
+#define SIGNED_DISTANCE_FIELD_H
+
+#include "Polygon.h"
+
+//- Signed distance and nearest edge of a polygon, sampled on a lattice fixed to the body. The lattice covers the
+//- bounding box of the polygon padded by a band, and follows the polygon by a rigid transformation.
+class SignedDistanceField
+{
+public:
+
+    SignedDistanceField(const Polygon &pgn, Scalar spacing, Scalar band);
+
+    //- Track the current position and orientation of the polygon the field was built from
+    void setPose(const Polygon &pgn);
+
+    Scalar spacing() const
+    { return h_; }
+
+    //- Queries, in world coordinates
+    bool isInside(const Point2D &pt) const;
+
+    Scalar distance(const Point2D &pt) const; // negative inside, exact outside the band
+
+    Point2D nearestIntersect(const Point2D &pt) const;
+
+    LineSegment2D nearestEdge(const Point2D &pt) const;
+
+    //- First crossing of the surface along a ray, found by walking the field from the origin of the ray
+    Point2D intersection(const Ray2D &ray) const;
+
+private:
+
+    Point2D toBody(const Point2D &pt) const
+    { return (pt - center_).rotate(-theta_); }
+
+    Point2D toWorld(const Point2D &pt) const
+    { return pt.rotate(theta_) + center_; }
+
+    bool inLattice(const Point2D &pt) const;
+
+    //- Lower left lattice node of the lattice cell containing a body frame point
+    std::pair<int, int> latticeCell(const Point2D &pt) const;
+
+    Label node(int i, int j) const
+    { return j * nx_ + i; }
+
+    Point2D nodePoint(int i, int j) const
+    { return origin_ + Vector2D(i * h_, j * h_); }
+
+    //- Exact nearest edge of a point in the lattice, in body coordinates
+    Label nearestEdgeId(const Point2D &pt) const;
+
+    Polygon ref_; // polygon relative to its centroid, at the orientation when the field was built
+    Vector2D refEdge_;
+
+    Point2D center_;
+    Scalar theta_;
+
+    Point2D origin_;
+    Scalar h_;
+    int nx_, ny_;
+
+    std::vector<Scalar> phi_;
+
+    //- Edges that can be nearest to a point in any lattice cell touching a node, stored per node in CSR form
+    std::vector<Label> candidateStart_, candidateIds_;
+};
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef BATCHED_MATRIX_H
+#define BATCHED_MATRIX_H
+
+#include <vector>
+
+#include "StaticMatrix.h"
+#include "DenseKernels.h"
+
+//- A batch of fixed size matrices, stored so that operations on the whole batch vectorize across it. Used to
+//- set up many small stencils at once instead of paying the library call overhead per stencil
+template<int M, int N = 1>
+class BatchedMatrix
+{
+public:
+
+    BatchedMatrix(Size size = 0) : size_(size), vals_(M * N * size, 0.)
+    {}
+
+    Size size() const
+    { return size_; }
+
+    void resize(Size size)
+    {
+        size_ = size;
+        vals_.assign(M * N * size, 0.);
+    }
+
+    Scalar *data()
+    { return vals_.data(); }
+
+    const Scalar *data() const
+    { return vals_.data(); }
+
+    Scalar &operator()(Label k, int i, int j)
+    { return vals_[(i * N + j) * size_ + k]; }
+
+    Scalar operator()(Label k, int i, int j) const
+    { return vals_[(i * N + j) * size_ + k]; }
+
+    StaticMatrix<M, N> get(Label k) const
+    {
+        StaticMatrix<M, N> mat;
+        for (int i = 0; i < M; ++i)
+            for (int j = 0; j < N; ++j)
+                mat(i, j) = (*this)(k, i, j);
+
+        return mat;
+    }
+
+    void set(Label k, const StaticMatrix<M, N> &mat)
+    {
+        for (int i = 0; i < M; ++i)
+            for (int j = 0; j < N; ++j)
+                (*this)(k, i, j) = mat(i, j);
+    }
+
+    //- Overwrites b with the solution for every system of the batch, the coefficients are destroyed
+    template<int K>
+    void solve(BatchedMatrix<M, K> &b)
+    {
+        static_assert(M == N, "Coefficient matrices must be square.");
+
+        if (b.size() != size_)
+            throw Exception("BatchedMatrix", "solve", "batch sizes do not match.");
+
+        gaussJordan<M, K>(size_, vals_.data(), b.data());
+    }
+
+    BatchedMatrix<M, N> &invert()
+    {
+        BatchedMatrix<M, N> inv(size_);
+        for (int i = 0; i < M; ++i)
+            std::fill(&inv(0, i, i), &inv(0, i, i) + size_, 1.);
+
+        solve(inv);
+        vals_.swap(inv.vals_);
+
+        return *this;
+    }
+
+private:
+
+    Size size_;
+    std::vector<Scalar> vals_;
+};
+
+template<int M, int N>
+BatchedMatrix<M, N> inverse(BatchedMatrix<M, N> A)
+{
+    A.invert();
+    return A;
+}
+
+template<int M, int N, int K>
+BatchedMatrix<M, K> operator*(const BatchedMatrix<M, N> &A, const BatchedMatrix<N, K> &B)
+{
+    if (A.size() != B.size())
+        throw Exception("BatchedMatrix", "operator*", "batch sizes do not match.");
+
+    BatchedMatrix<M, K> C(A.size());
+    multiply<M, N, K>(A.size(), A.data(), B.data(), C.data());
+
+    return C;
+}
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef DENSE_KERNELS_H
+#define DENSE_KERNELS_H
+
+#include <cmath>
+#include <algorithm>
+
+#include "Types.h"
+#include "Exception.h"
+
+//- Fixed size dense kernels operating on a batch of nSys systems. Entry (i, j) of system k is stored at
+//- a[(i * N + j) * nSys + k], so the innermost loops run across the batch and vectorize. A batch of one is an
+//- ordinary row major matrix
+
+namespace detail
+{
+    //- Elimination on one tile of systems, with entries stored at a stride of T
+    template<int N, int K, int T>
+    void gaussJordanTile(Size nSys, Scalar *a, Scalar *b)
+    {
+        for (int p = 0; p < N; ++p)
+        {
+            //- Pivot rows differ between systems, so the search and swaps are done with selects across the batch
+            int r[T];
+            Scalar pivot[T];
+
+#pragma omp simd
+            for (Size k = 0; k < nSys; ++k)
+            {
+                r[k] = p;
+                pivot[k] = std::abs(a[(p * N + p) * T + k]);
+            }
+
+            for (int i = p + 1; i < N; ++i)
+            {
+                const Scalar *aip = a + (i * N + p) * T;
+#pragma omp simd
+                for (Size k = 0; k < nSys; ++k)
+                {
+                    bool larger = std::abs(aip[k]) > pivot[k];
+                    pivot[k] = larger ? std::abs(aip[k]) : pivot[k];
+                    r[k] = larger ? i : r[k];
+                }
+            }
+
+            for (Size k = 0; k < nSys; ++k)
+                if (pivot[k] == 0.)
+                    throw Exception("DenseKernels", "gaussJordan", "matrix is singular to working precision.");
+
+            for (int i = p + 1; i < N; ++i)
+            {
+                for (int j = p; j < N; ++j)
+                {
+                    Scalar *apj = a + (p * N + j) * T, *aij = a + (i * N + j) * T;
+#pragma omp simd
+                    for (Size k = 0; k < nSys; ++k)
+                    {
+                        Scalar tmp = apj[k];
+                        apj[k] = r[k] == i ? aij[k] : apj[k];
+                        aij[k] = r[k] == i ? tmp : aij[k];
+                    }
+                }
+
+                for (int j = 0; j < K; ++j)
+                {
+                    Scalar *bpj = b + (p * K + j) * T, *bij = b + (i * K + j) * T;
+#pragma omp simd
+                    for (Size k = 0; k < nSys; ++k)
+                    {
+                        Scalar tmp = bpj[k];
+                        bpj[k] = r[k] == i ? bij[k] : bpj[k];
+                        bij[k] = r[k] == i ? tmp : bij[k];
+                    }
+                }
+            }
+
+            //- Scale the pivot row, columns left of the pivot are already eliminated
+            Scalar rPivot[T];
+            const Scalar *app = a + (p * N + p) * T;
+
+#pragma omp simd
+            for (Size k = 0; k < nSys; ++k)
+                rPivot[k] = 1. / app[k];
+
+            for (int j = p + 1; j < N; ++j)
+            {
+                Scalar *apj = a + (p * N + j) * T;
+#pragma omp simd
+                for (Size k = 0; k < nSys; ++k)
+                    apj[k] *= rPivot[k];
+            }
+
+            for (int j = 0; j < K; ++j)
+            {
+                Scalar *bpj = b + (p * K + j) * T;
+#pragma omp simd
+                for (Size k = 0; k < nSys; ++k)
+                    bpj[k] *= rPivot[k];
+            }
+
+            for (int i = 0; i < N; ++i)
+            {
+                if (i == p)
+                    continue;
+
+                const Scalar *aip = a + (i * N + p) * T;
+
+                for (int j = p + 1; j < N; ++j)
+                {
+                    Scalar *aij = a + (i * N + j) * T;
+                    const Scalar *apj = a + (p * N + j) * T;
+#pragma omp simd
+                    for (Size k = 0; k < nSys; ++k)
+                        aij[k] -= aip[k] * apj[k];
+                }
+
+                for (int j = 0; j < K; ++j)
+                {
+                    Scalar *bij = b + (i * K + j) * T;
+                    const Scalar *bpj = b + (p * K + j) * T;
+#pragma omp simd
+                    for (Size k = 0; k < nSys; ++k)
+                        bij[k] -= aip[k] * bpj[k];
+                }
+            }
+        }
+    }
+}
+
+//- Gauss-Jordan elimination with partial pivoting, overwrites b with inv(a) * b and destroys a
+template<int N, int K>
+void gaussJordan(Size nSys, Scalar *a, Scalar *b)
+{
+    if (nSys == 1)
+    {
+        detail::gaussJordanTile<N, K, 1>(1, a, b);
+        return;
+    }
+
+    //- Larger batches are copied tile by tile into contiguous buffers that stay in cache for the whole elimination
+    const int T = 32;
+    Scalar ta[N * N * T], tb[N * K * T];
+
+    for (Size k0 = 0; k0 < nSys; k0 += T)
+    {
+        const Size n = std::min<Size>(T, nSys - k0);
+
+        for (int ij = 0; ij < N * N; ++ij)
+            std::copy(a + ij * nSys + k0, a + ij * nSys + k0 + n, ta + ij * T);
+
+        for (int ij = 0; ij < N * K; ++ij)
+            std::copy(b + ij * nSys + k0, b + ij * nSys + k0 + n, tb + ij * T);
+
+        detail::gaussJordanTile<N, K, T>(n, ta, tb);
+
+        for (int ij = 0; ij < N * N; ++ij)
+            std::copy(ta + ij * T, ta + ij * T + n, a + ij * nSys + k0);
+
+        for (int ij = 0; ij < N * K; ++ij)
+            std::copy(tb + ij * T, tb + ij * T + n, b + ij * nSys + k0);
+    }
+}
+
+//- c = a * b for a batch of M x N and N x K matrices
+template<int M, int N, int K>
+void multiply(Size nSys, const Scalar *a, const Scalar *b, Scalar *c)
+{
+    std::fill(c, c + M * K * nSys, 0.);
+
+    for (int i = 0; i < M; ++i)
+        for (int l = 0; l < N; ++l)
+        {
+            const Scalar *ail = a + (i * N + l) * nSys;
+
+            for (int j = 0; j < K; ++j)
+            {
+                const Scalar *blj = b + (l * K + j) * nSys;
+                Scalar *cij = c + (i * K + j) * nSys;
+#pragma omp simd
+                for (Size k = 0; k < nSys; ++k)
+                    cij[k] += ail[k] * blj[k];
+            }
+        }
+}
+
+#endif
@@ -13,6 +13,14 @@ public:
     typedef std::vector<Entry> Row;
     typedef std::vector<Row> CoefficientList;
 
+    //- Topology version of the grid the next system is assembled on. Cached matrix structure must be
+    //- discarded whenever it changes
+    void setTopologyVersion(Size version)
+    {
+        topologyChanged_ = version != topologyVersion_;
+        topologyVersion_ = version;
+    }
+
     virtual void setRank(int rank) = 0;
 
     virtual void set(const CoefficientList &eqn) = 0;
@@ -31,6 +39,12 @@ public:
 
     virtual void setup(const boost::property_tree::ptree& parameters) {}
 
+    //- Convergence tolerance of iterative solvers, negative for direct solvers which ignore it
+    virtual Scalar tolerance() const
+    { return -1.; }
+
+    virtual void setTolerance(Scalar tolerance) {}
+
     virtual int nIters() const = 0;
 
     virtual Scalar error() const = 0;
@@ -41,6 +55,9 @@ public:
 
 protected:
     int nPreconUses_ = 1, maxPreconUses_ = 1;
+
+    Size topologyVersion_ = 0;
+    bool topologyChanged_ = true;
 };
 
 #include "EigenSparseMatrixSolver.h"
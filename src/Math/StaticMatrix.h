@@ -5,6 +5,7 @@
 
 #include "Types.h"
 #include "Exception.h"
+#include "DenseKernels.h"
 
 #ifdef __INTEL_COMPILER
 #include <mkl.h>
@@ -77,13 +78,17 @@ public:
         return diag;
     };
 
+    //- Small systems are solved inline, the library call overhead would dominate
     StaticMatrix<M, N> &invert()
     {
-        lapack_int info1 = LAPACKE_dgetrf(LAPACK_ROW_MAJOR, M, N, vals_, N, ipiv_);
-        lapack_int info2 = LAPACKE_dgetri(LAPACK_ROW_MAJOR, M, vals_, N, ipiv_);
+        static_assert(M == N, "Matrix must be square.");
 
-        if (info1 != 0 || info2 != 0)
-            throw Exception("StaticMatrix", "invert", "inversion failed, matrix is singular to working precision.");
+        StaticMatrix<M, N> inv;
+        for (int i = 0; i < M; ++i)
+            inv(i, i) = 1.;
+
+        gaussJordan<M, N>(1, vals_, inv.vals_);
+        std::copy(inv.vals_, inv.vals_ + M * N, vals_);
 
         return *this;
     };
@@ -92,7 +97,7 @@ public:
     void solve(StaticMatrix<M, K> &b)
     {
         static_assert(M == N, "Coefficient matrix must be square.");
-        LAPACKE_dgesv(LAPACK_ROW_MAJOR, M, K, vals_, N, ipiv_, b.data(), K);
+        gaussJordan<M, K>(1, vals_, b.data());
     }
 
     StaticMatrix<M, N> &operator*=(Scalar scalar)
@@ -114,7 +119,6 @@ public:
 private:
 
     Scalar vals_[M * N];
-    int ipiv_[M];
 };
 
 template<int M>
@@ -172,10 +176,7 @@ template<int M, int N, int K>
 StaticMatrix<M, K> operator*(const StaticMatrix<M, N> &A, const StaticMatrix<N, K> &B)
 {
     StaticMatrix<M, K> C;
-
-    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
-                A.m(), B.n(), A.n(), 1., A.data(), A.n(),
-                B.data(), B.n(), 1., C.data(), C.n());
+    multiply<M, N, K>(1, A.data(), B.data(), C.data());
 
     return C;
 }
@@ -121,6 +121,19 @@ void TrilinosBelosSparseMatrixSolver::setup(const boost::property_tree::ptree& p
     schwarzParams_->set("schwarz: inner preconditioner parameters", *ifpackParams_);
 }
 
+Scalar TrilinosBelosSparseMatrixSolver::tolerance() const
+{
+    return belosParams_->get<Scalar>("Convergence Tolerance");
+}
+
+void TrilinosBelosSparseMatrixSolver::setTolerance(Scalar tolerance)
+{
+    belosParams_->set("Convergence Tolerance", tolerance);
+
+    if (!solver_.is_null())
+        solver_->setParameters(belosParams_);
+}
+
 int TrilinosBelosSparseMatrixSolver::nIters() const
 {
     return solver_->getNumIters();
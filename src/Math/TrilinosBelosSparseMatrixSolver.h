@@ -31,6 +31,10 @@ public:
 
     void setup(const boost::property_tree::ptree& parameters);
 
+    Scalar tolerance() const;
+
+    void setTolerance(Scalar tolerance);
+
     int nIters() const;
 
     Scalar error() const;
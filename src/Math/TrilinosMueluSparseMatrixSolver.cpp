@@ -18,7 +18,8 @@ void TrilinosMueluSparseMatrixSolver::setRank(int rank)
 
     auto map = rcp(new TpetraMap(OrdinalTraits<Tpetra::global_size_t>::invalid(), rank, 0, Tcomm_));
 
-    if (map_.is_null() || !map_->isSameAs(*map)) //- Check if a new map is needed
+    //- A new matrix is needed if the map or the sparsity pattern may have changed
+    if (map_.is_null() || !map_->isSameAs(*map) || topologyChanged_)
     {
         map_ = map;
         mat_ = rcp(new TpetraCrsMatrix(map_, 5, Tpetra::StaticProfile));
@@ -136,6 +137,19 @@ void TrilinosMueluSparseMatrixSolver::setup(const boost::property_tree::ptree &p
     std::cout << mueluParams_ << std::endl;
 }
 
+Scalar TrilinosMueluSparseMatrixSolver::tolerance() const
+{
+    return belosParams_->get<Scalar>("Convergence Tolerance");
+}
+
+void TrilinosMueluSparseMatrixSolver::setTolerance(Scalar tolerance)
+{
+    belosParams_->set("Convergence Tolerance", tolerance);
+
+    if (!solver_.is_null())
+        solver_->setParameters(belosParams_);
+}
+
 int TrilinosMueluSparseMatrixSolver::nIters() const
 {
     return solver_->getNumIters();
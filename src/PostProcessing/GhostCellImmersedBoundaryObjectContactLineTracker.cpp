@@ -84,7 +84,7 @@ void GhostCellImmersedBoundaryObjectContactLineTracker::compute(Scalar time)
                     {
                         Scalar alpha = (0.5 - ptB.second) / (ptA.second - ptB.second);
 
-                        Point2D xc = gcIbObj->shape().nearestIntersect(
+                        Point2D xc = gcIbObj->nearestIntersect(
                                 alpha * ptA.first + (1. - alpha) * ptB.first
                         );
 
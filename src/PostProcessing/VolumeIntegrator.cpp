@@ -3,7 +3,8 @@
 VolumeIntegrator::VolumeIntegrator(const Solver &solver, const std::string &fieldName)
         :
         PostProcessingObject(solver),
-        field_(solver.scalarField(fieldName))
+        field_(solver.scalarField(fieldName)),
+        reductions_(solver.grid().comm())
 {
     outputDir_ = outputDir_ / "VolumeIntegrators";
 
@@ -15,23 +16,43 @@ VolumeIntegrator::VolumeIntegrator(const Solver &solver, const std::string &fiel
     fout.close();
 }
 
+VolumeIntegrator::~VolumeIntegrator()
+{
+    write();
+}
+
 void VolumeIntegrator::compute(Scalar time)
 {
     if(iterNo_++ % fileWriteFrequency_ == 0)
     {
+        write();
+
         Scalar result = 0.;
 
         for (const Cell &cell: solver_.grid().localActiveCells())
             result += field_(cell) * cell.volume();
 
-        result = solver_.grid().comm().sum(result);
+        result_ = reductions_.sum(result);
+        resultTime_ = time;
+        reductions_.start();
+    }
+}
 
-        if (solver_.grid().comm().isMainProc())
-        {
-            std::ofstream fout((outputDir_ / (field_.name() + ".dat")).string(),
-                               std::ofstream::out | std::ofstream::app);
-            fout << time << "\t" << result << "\n";
-            fout.close();
-        }
+//- Private methods
+
+void VolumeIntegrator::write()
+{
+    if (!result_.valid())
+        return;
+
+    Scalar result = result_.get();
+    result_ = ReductionBatch::Result();
+
+    if (solver_.grid().comm().isMainProc())
+    {
+        std::ofstream fout((outputDir_ / (field_.name() + ".dat")).string(),
+                           std::ofstream::out | std::ofstream::app);
+        fout << resultTime_ << "\t" << result << "\n";
+        fout.close();
     }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define VOLUME_INTEGRATOR_H
 
 #include "PostProcessingObject.h"
+#include "ReductionBatch.h"
 
 class VolumeIntegrator : public PostProcessingObject
 {
@@ -9,12 +10,21 @@ public:
 
     VolumeIntegrator(const Solver &solver, const std::string &fieldName);
 
+    ~VolumeIntegrator();
+
     void compute(Scalar time);
 
 private:
 
+    void write();
+
     const ScalarFiniteVolumeField& field_;
 
+    //- The reduction completes in the background and is written on the next call
+    ReductionBatch reductions_;
+    ReductionBatch::Result result_;
+    Scalar resultTime_;
+
 };
 
 
@@ -1,5 +1,7 @@
 #include <ImmersedBoundary/QuadraticImmersedBoundaryObject.h>
 #include <ImmersedBoundary/HighOrderImmersedBoundaryObject.h>
+#include <limits>
+
 #include "Celeste.h"
 #include "Algorithm.h"
 #include "GhostCellImmersedBoundaryObject.h"
@@ -12,13 +14,28 @@ Celeste::Celeste(const Input &input,
                  const VectorFiniteVolumeField &u,
                  const ScalarGradient &gradGamma)
         :
-        SurfaceTensionForce(input, ib, gamma, rho, mu, u, gradGamma)
+        SurfaceTensionForce(input, ib, gamma, rho, mu, u, gradGamma),
+        band_("InterfaceBand")
 {
+    //- The band must cover the smoothing kernel, plus the layers needed by the gradient, curvature and face stencils
+    Scalar minSpacing = std::numeric_limits<Scalar>::infinity();
+
+    for (const Face &face: grid_->interiorFaces())
+        minSpacing = std::min(minSpacing, (face.rCell().centroid() - face.lCell().centroid()).mag());
+
+    minSpacing = grid_->comm().min(minSpacing);
+
+    bandLayers_ = (int) std::ceil(kernelWidth_ / minSpacing)
+                  + input.caseInput().get<int>("Solver.interfaceBandLayers", 3);
+
+    bandLayer_.assign(grid_->cells().size(), bandLayers_ + 1);
+
     constructMatrices();
 }
 
 void Celeste::computeFaces()
 {
+    updateBand();
     computeGradGammaTilde();
     computeInterfaceNormals();
     computeCurvature();
@@ -26,12 +43,21 @@ void Celeste::computeFaces()
     auto &ft = *this;
     auto &kappa = *kappa_;
 
-    for (const Face &face: gamma_.grid().faces())
-        ft(face) = sigma_ * kappa(face) * gradGamma_(face);
+    ft.fill(Vector2D(0., 0.));
+
+    for (const Cell &cell: band_)
+    {
+        for (const InteriorLink &nb: cell.neighbours())
+            ft(nb.face()) = sigma_ * kappa(nb.face()) * gradGamma_(nb.face());
+
+        for (const BoundaryLink &bd: cell.boundaries())
+            ft(bd.face()) = sigma_ * kappa(bd.face()) * gradGamma_(bd.face());
+    }
 }
 
 void Celeste::computeFaces(const ImmersedBoundary &ib)
 {
+    updateBand();
     computeGradGammaTilde(ib);
     computeInterfaceNormals();
     computeCurvature(ib);
@@ -39,16 +65,25 @@ void Celeste::computeFaces(const ImmersedBoundary &ib)
     auto &ft = *this;
     auto &kappa = *kappa_;
 
-    for (const Face &f: grid_->interiorFaces())
-        ft(f) = ib_.ibObj(f.lCell().centroid()) || ib_.ibObj(f.rCell().centroid())
-                ? Vector2D(0., 0.) : sigma_ * kappa(f) * gradGamma_(f);
+    ft.fill(Vector2D(0., 0.));
 
-    for (const Face &f: grid_->boundaryFaces())
-        ft(f) = sigma_ * kappa(f) * gradGamma_(f);
+    for (const Cell &cell: band_)
+    {
+        for (const InteriorLink &nb: cell.neighbours())
+        {
+            const Face &f = nb.face();
+            ft(f) = ib_.ibObj(f.lCell().centroid()) || ib_.ibObj(f.rCell().centroid())
+                    ? Vector2D(0., 0.) : sigma_ * kappa(f) * gradGamma_(f);
+        }
+
+        for (const BoundaryLink &bd: cell.boundaries())
+            ft(bd.face()) = sigma_ * kappa(bd.face()) * gradGamma_(bd.face());
+    }
 }
 
 void Celeste::compute()
 {
+    updateBand();
     computeGradGammaTilde();
     computeInterfaceNormals();
     computeCurvature();
@@ -57,12 +92,13 @@ void Celeste::compute()
     auto &kappa = *kappa_;
 
     ft.fill(Vector2D(0., 0.));
-    for (const Cell &cell: gamma_.grid().cellZone("fluid"))
+    for (const Cell &cell: band_)
         ft(cell) = sigma_ * kappa(cell) * gradGamma_(cell);
 }
 
 void Celeste::compute(const ImmersedBoundary &ib)
 {
+    updateBand();
     computeGradGammaTilde();
     computeInterfaceNormals();
     computeCurvature(ib);
@@ -72,7 +108,7 @@ void Celeste::compute(const ImmersedBoundary &ib)
 
     ft.fill(Vector2D(0, 0));
 
-    for (const Cell &cell: grid_->cellZone("fluid"))
+    for (const Cell &cell: band_)
         ft(cell) = sigma_ * kappa(cell) * gradGamma_(cell);
 
     ft.interpolateFaces();
@@ -80,14 +116,65 @@ void Celeste::compute(const ImmersedBoundary &ib)
 
 void Celeste::constructMatrices()
 {
-    kappaStencils_.resize(grid_->cells().size());
-    gradGammaTildeStencils_.resize(grid_->cells().size());
+    //- Stencils are built lazily, as cells enter the interface band
+    kappaStencils_.assign(grid_->cells().size(), CelesteStencil());
+    gradGammaTildeStencils_.assign(grid_->cells().size(), CelesteStencil());
 
-    for (const Cell &cell: grid_->localActiveCells())
+    initBandStencils();
+}
+
+void Celeste::computeInterfaceNormals()
+{
+    n_->fill(Vector2D(0., 0.));
+    SurfaceTensionForce::computeInterfaceNormals(band_);
+}
+
+Equation<Vector2D> Celeste::laplaceBeltrami(VectorFiniteVolumeField &u, Scalar timeStep) const
+{
+    Equation<Vector2D> eqn(u);
+    const auto &n = *n_;
+
+    //- The interface moves with u over the step, so the curvature at the new time level gains a surface diffusion
+    //- of u. Only the tangential projection of each face is kept, giving a two point surface laplacian
+    for (const Cell &cell: band_)
     {
-        kappaStencils_[cell.id()] = CelesteStencil(cell, false);
-        gradGammaTildeStencils_[cell.id()] = CelesteStencil(cell, true);
+        //- Green-Gauss gradient of the current velocities in the cell, projected onto k
+        auto gradU = [&cell, &u](const Vector2D &k) {
+            Vector2D sum(0., 0.);
+
+            for (const InteriorLink &nb: cell.neighbours())
+                sum += dot(nb.outwardNorm(), k) * u(nb.face());
+
+            for (const BoundaryLink &bd: cell.boundaries())
+                sum += dot(bd.outwardNorm(), k) * u(bd.face());
+
+            return sum / cell.volume();
+        };
+
+        for (const InteriorLink &nb: cell.neighbours())
+        {
+            const Face &f = nb.face();
+            Vector2D nf = n(cell) + n(nb.cell());
+
+            if (nf.magSqr() == 0. || ib_.ibObj(f.lCell().centroid()) || ib_.ibObj(f.rCell().centroid()))
+                continue;
+
+            nf = nf.unitVec();
+            Vector2D sf = nb.outwardNorm() - dot(nb.outwardNorm(), nf) * nf;
+            Vector2D rc = nb.rCellVec();
+            Scalar w = sigma_ * timeStep * gradGamma_(f).mag();
+
+            //- The tangential face vector is generally not aligned with the cell link. Only the part along the link
+            //- is implicit, which keeps the coefficients non-negative, the remainder is deferred to the source
+            Scalar coeff = w * sf.mag() / rc.mag();
+
+            eqn.add(cell, nb.cell(), coeff);
+            eqn.add(cell, cell, -coeff);
+            eqn.addSource(cell, w * gradU(sf - sf.mag() * rc / rc.mag()));
+        }
     }
+
+    return eqn;
 }
 
 Equation<Scalar> Celeste::contactLineBcs(const ImmersedBoundary &ib)
@@ -109,8 +196,8 @@ Equation<Scalar> Celeste::contactLineBcs(const ImmersedBoundary &ib)
                     Ray2D r1 = Ray2D(st.cell().centroid(), wn.rotate(M_PI_2 - theta));
                     Ray2D r2 = Ray2D(st.cell().centroid(), wn.rotate(theta - M_PI_2));
 
-                    GhostCellStencil m1(st.cell(), ibObj->shape().intersections(r1)[0], r1.r(), grid());
-                    GhostCellStencil m2(st.cell(), ibObj->shape().intersections(r2)[0], r2.r(), grid());
+                    GhostCellStencil m1(st.cell(), ibObj->intersection(r1), r1.r(), grid());
+                    GhostCellStencil m2(st.cell(), ibObj->intersection(r2), r2.r(), grid());
 
                     if (theta < M_PI_2)
                     {
@@ -142,8 +229,8 @@ Equation<Scalar> Celeste::contactLineBcs(const ImmersedBoundary &ib)
                     Ray2D r1 = Ray2D(cell.centroid(), wn.rotate(M_PI_2 - theta));
                     Ray2D r2 = Ray2D(cell.centroid(), wn.rotate(theta - M_PI_2));
 
-                    GhostCellStencil m1(cell, ibObj->shape().intersections(r1)[0], r1.r(), grid());
-                    GhostCellStencil m2(cell, ibObj->shape().intersections(r2)[0], r2.r(), grid());
+                    GhostCellStencil m1(cell, ibObj->intersection(r1), r1.r(), grid());
+                    GhostCellStencil m2(cell, ibObj->intersection(r2), r2.r(), grid());
 
                     if (theta < M_PI_2)
                     {
@@ -183,35 +270,42 @@ Equation<Scalar> Celeste::contactLineBcs(const ImmersedBoundary &ib)
 
 void Celeste::computeGradGammaTilde()
 {
-    smoothGammaField();
-
     auto &gammaTilde = *gammaTilde_;
     auto &gradGammaTilde = *gradGammaTilde_;
 
+    //- Outside the band the kernel only sees one phase, so smoothing leaves gamma unchanged
+    for (const Cell &cell: grid_->localActiveCells())
+        gammaTilde(cell) = gamma_(cell);
+
+    smoothGammaField(band_, grid_->cellZone("fluid"));
+
     gradGammaTilde_->fill(Vector2D(0., 0.));
-    for (const Cell &cell: gradGamma_.grid().cellZone("fluid"))
+    for (const Cell &cell: band_)
         gradGammaTilde(cell) = gradGammaTildeStencils_[cell.id()].grad(gammaTilde);
 }
 
 void Celeste::computeGradGammaTilde(const ImmersedBoundary &ib)
 {
-    smoothGammaField(ib);
-
     auto &gammaTilde = *gammaTilde_;
     auto &gradGammaTilde = *gradGammaTilde_;
 
+    for (const Cell &cell: grid_->localActiveCells())
+        gammaTilde(cell) = gamma_(cell);
+
+    smoothGammaField(band_, nonSolidCells(ib), true);
+
     gradGammaTilde_->fill(Vector2D(0., 0.));
-    for (const Cell &cell: gradGamma_.grid().cellZone("fluid"))
+    for (const Cell &cell: band_)
         gradGammaTilde(cell) = gradGammaTildeStencils_[cell.id()].grad(gammaTilde);
 }
 
 void Celeste::computeCurvature()
 {
-    Matrix bx(8, 1), by(8, 1);
     auto &n = *n_;
     auto &kappa = *kappa_;
 
-    for (const Cell &cell: grid_->cellZone("fluid"))
+    kappa.fill(0.);
+    for (const Cell &cell: band_)
         kappa(cell) = kappaStencils_[cell.id()].div(n);
 
     grid_->sendMessages(kappa);
@@ -227,7 +321,7 @@ void Celeste::computeCurvature(const ImmersedBoundary &ib)
     auto &kappa = *kappa_;
     const auto &gradGammaTilde = *gradGammaTilde_;
 
-    for (const Cell &cell: grid_->cellZone("fluid"))
+    for (const Cell &cell: band_)
         if (gradGammaTilde(cell).magSqr() > 0.)
             kappa(cell) = kappaStencils_[cell.id()].kappa(n, ib, *this);
 
@@ -254,11 +348,130 @@ void Celeste::updateStencils(const ImmersedBoundary &ib)
         return false;
     };
 
-    for (const Cell &cell: grid_->cellZone("fluid"))
+    std::vector<CelesteStencil *> stencils;
+
+    for (const Cell &cell: band_)
     {
         CelesteStencil &st = kappaStencils_[cell.id()];
 
         if (updateRequired(st))
+        {
             st.init(ib);
+            stencils.push_back(&st);
+        }
     }
+
+    CelesteStencil::initPseudoInverses(stencils);
+}
+
+void Celeste::updateBand()
+{
+    const CellZone &fluid = grid_->cellZone("fluid");
+    const int outside = bandLayers_ + 1;
+
+    auto isInterface = [this](const Cell &cell) {
+        if (gamma_(cell) > eps_ && gamma_(cell) < 1. - eps_)
+            return true;
+
+        for (const InteriorLink &nb: cell.neighbours())
+            if ((gamma_(nb.cell()) < 0.5) != (gamma_(cell) < 0.5))
+                return true;
+
+        return false;
+    };
+
+    //- The interface moves less than a cell per time step, so it is only searched for within the previous band. A
+    //- full search is done if there is no band yet, or if the interface was found further out than expected
+    std::vector<Ref<const Cell>> front;
+
+    if (searchAll_ || band_.empty())
+    {
+        for (const Cell &cell: fluid)
+            if (isInterface(cell))
+                front.push_back(cell);
+
+        searchAll_ = false;
+    }
+    else
+    {
+        for (const Cell &cell: band_)
+            if (isInterface(cell))
+                front.push_back(cell);
+
+        for (const Cell &cell: front)
+            searchAll_ = searchAll_ || bandLayer_[cell.id()] > 1;
+    }
+
+    //- Reset the old band
+    for (const Cell &cell: band_)
+        bandLayer_[cell.id()] = outside;
+
+    for (const CellZone &zone: grid_->bufferZones())
+        for (const Cell &cell: zone)
+            bandLayer_[cell.id()] = outside;
+
+    band_.clear();
+
+    for (const Cell &cell: front)
+    {
+        bandLayer_[cell.id()] = 0;
+        band_.add(cell);
+    }
+
+    //- Grow the band one layer at a time, exchanging layers so that it is consistent across ranks
+    grid_->sendMessages(bandLayer_);
+
+    for (int layer = 1; layer <= bandLayers_; ++layer)
+    {
+        for (const CellZone &zone: grid_->bufferZones())
+            for (const Cell &cell: zone)
+                if (bandLayer_[cell.id()] == layer - 1)
+                    front.push_back(cell);
+
+        std::vector<Ref<const Cell>> next;
+
+        auto grow = [&](const Cell &cell) {
+            if (bandLayer_[cell.id()] == outside && fluid.isInGroup(cell))
+            {
+                bandLayer_[cell.id()] = layer;
+                band_.add(cell);
+                next.push_back(cell);
+            }
+        };
+
+        for (const Cell &cell: front)
+        {
+            for (const InteriorLink &nb: cell.neighbours())
+                grow(nb.cell());
+
+            for (const CellLink &dg: cell.diagonals())
+                grow(dg.cell());
+        }
+
+        front = std::move(next);
+        grid_->sendMessages(bandLayer_);
+    }
+
+    initBandStencils();
+}
+
+void Celeste::initBandStencils()
+{
+    std::vector<CelesteStencil *> stencils;
+
+    for (const Cell &cell: band_)
+    {
+        if (kappaStencils_[cell.id()].initialized())
+            continue;
+
+        kappaStencils_[cell.id()] = CelesteStencil(cell);
+        kappaStencils_[cell.id()].init(false);
+        gradGammaTildeStencils_[cell.id()] = CelesteStencil(cell);
+        gradGammaTildeStencils_[cell.id()].init(true);
+
+        stencils.push_back(&kappaStencils_[cell.id()]);
+        stencils.push_back(&gradGammaTildeStencils_[cell.id()]);
+    }
+
+    CelesteStencil::initPseudoInverses(stencils);
 }
@@ -27,8 +27,15 @@ public:
 
     void constructMatrices();
 
+    void computeInterfaceNormals();
+
     Equation<Scalar> contactLineBcs(const ImmersedBoundary& ib);
 
+    //- Implicit part of a semi-implicit surface tension force, the interface diffusion
+    //- sigma * dt * delta * Laplace-Beltrami(u) that damps capillary waves. Must follow computeFaces, the
+    //- non-orthogonal correction is explicit in the current values of u
+    Equation<Vector2D> laplaceBeltrami(VectorFiniteVolumeField &u, Scalar timeStep) const;
+
 protected:
 
     class CelesteStencil
@@ -37,17 +44,25 @@ protected:
 
         CelesteStencil() {}
 
+        explicit CelesteStencil(const Cell& cell) : cellPtr_(&cell) {}
+
         CelesteStencil(const Cell& cell, bool weighted);
 
         CelesteStencil(const Cell& cell, const ImmersedBoundary& ib, bool weighted);
 
+        //- Set up the least-squares rows only, the pseudo-inverses are computed by initPseudoInverses
         void init(bool weighted = false);
 
         void init(const ImmersedBoundary& ib, bool weighted = false);
 
+        static void initPseudoInverses(const std::vector<CelesteStencil*>& stencils);
+
         const Cell& cell() const
         { return *cellPtr_; }
 
+        bool initialized() const
+        { return cellPtr_ != nullptr; }
+
         bool weighted() const
         { return weighted_; }
 
@@ -66,7 +81,7 @@ protected:
 
         bool truncated_, weighted_;
 
-        Matrix pInv_;
+        Matrix A_, pInv_;
 
     };
 
@@ -80,8 +95,18 @@ protected:
 
     void updateStencils(const ImmersedBoundary& ib);
 
+    //- Interface narrow band, all surface tension kernels are restricted to it
+    void updateBand();
+
+    void initBandStencils();
+
     std::vector<bool> modifiedStencil_;
     std::vector<CelesteStencil> kappaStencils_, gradGammaTildeStencils_;
+
+    int bandLayers_;
+    bool searchAll_ = true;
+    std::vector<int> bandLayer_; // layers from the interface, bandLayers_ + 1 outside the band
+    CellGroup band_;
 };
 
 #endif
@@ -1,10 +1,12 @@
 #include "Celeste.h"
+#include "BatchedMatrix.h"
 
 Celeste::CelesteStencil::CelesteStencil(const Cell &cell, bool weighted)
         :
         cellPtr_(&cell)
 {
     init(weighted);
+    initPseudoInverses({this});
 }
 
 Celeste::CelesteStencil::CelesteStencil(const Cell &cell, const ImmersedBoundary &ib, bool weighted)
@@ -12,6 +14,7 @@ Celeste::CelesteStencil::CelesteStencil(const Cell &cell, const ImmersedBoundary
         cellPtr_(&cell)
 {
     init(ib, weighted);
+    initPseudoInverses({this});
 }
 
 void Celeste::CelesteStencil::init(bool weighted)
@@ -21,14 +24,14 @@ void Celeste::CelesteStencil::init(bool weighted)
 
     const Cell &cell = *cellPtr_;
 
-    Matrix A(cell.neighbours().size() + cell.diagonals().size() + cell.boundaries().size(), 5);
+    A_ = Matrix(cell.neighbours().size() + cell.diagonals().size() + cell.boundaries().size(), 5);
 
     int i = 0;
     for (const InteriorLink &nb: cell.neighbours())
     {
         Vector2D r = nb.rCellVec() / (weighted_ ? nb.rCellVec().magSqr() : 1.);
 
-        A.setRow(i++, {
+        A_.setRow(i++, {
                 r.x * r.x / 2.,
                 r.y * r.y / 2.,
                 r.x * r.y,
@@ -41,7 +44,7 @@ void Celeste::CelesteStencil::init(bool weighted)
     {
         Vector2D r = dg.rCellVec() / (weighted_ ? dg.rCellVec().magSqr() : 1.);
 
-        A.setRow(i++, {
+        A_.setRow(i++, {
                 r.x * r.x / 2.,
                 r.y * r.y / 2.,
                 r.x * r.y,
@@ -54,7 +57,7 @@ void Celeste::CelesteStencil::init(bool weighted)
     {
         Vector2D r = bd.rFaceVec() / (weighted_ ? bd.rFaceVec().magSqr() : 1.);
 
-        A.setRow(i++, {
+        A_.setRow(i++, {
                 r.x * r.x / 2.,
                 r.y * r.y / 2.,
                 r.x * r.y,
@@ -62,14 +65,12 @@ void Celeste::CelesteStencil::init(bool weighted)
                 r.y
         });
     }
-
-    pInv_ = inverse(transpose(A) * A) * transpose(A);
 }
 
 void Celeste::CelesteStencil::init(const ImmersedBoundary &ib, bool weighted)
 {
     const Cell &cell = *cellPtr_;
-    Matrix A(cell.neighbours().size() + cell.diagonals().size() + cell.boundaries().size(), 5);
+    A_ = Matrix(cell.neighbours().size() + cell.diagonals().size() + cell.boundaries().size(), 5);
 
     truncated_ = false;
 
@@ -80,7 +81,7 @@ void Celeste::CelesteStencil::init(const ImmersedBoundary &ib, bool weighted)
 
         Vector2D r = ibObj ? ibObj->intersectionLine(cell.centroid(), nb.cell().centroid()).rVec() : nb.rCellVec();
 
-        A.setRow(i++, {
+        A_.setRow(i++, {
                 r.x * r.x / 2.,
                 r.y * r.y / 2.,
                 r.x * r.y,
@@ -97,7 +98,7 @@ void Celeste::CelesteStencil::init(const ImmersedBoundary &ib, bool weighted)
 
         Vector2D r = ibObj ? ibObj->intersectionLine(cell.centroid(), dg.cell().centroid()).rVec() : dg.rCellVec();
 
-        A.setRow(i++, {
+        A_.setRow(i++, {
                 r.x * r.x / 2.,
                 r.y * r.y / 2.,
                 r.x * r.y,
@@ -112,7 +113,7 @@ void Celeste::CelesteStencil::init(const ImmersedBoundary &ib, bool weighted)
     {
         Vector2D r = bd.rFaceVec();
 
-        A.setRow(i++, {
+        A_.setRow(i++, {
                 r.x * r.x / 2.,
                 r.y * r.y / 2.,
                 r.x * r.y,
@@ -120,8 +121,37 @@ void Celeste::CelesteStencil::init(const ImmersedBoundary &ib, bool weighted)
                 r.y
         });
     }
+}
+
+void Celeste::CelesteStencil::initPseudoInverses(const std::vector<CelesteStencil *> &stencils)
+{
+    //- The normal equations always have five unknowns, so they are inverted together in one batch
+    BatchedMatrix<5, 5> AtA(stencils.size());
 
-    pInv_ = inverse(transpose(A) * A) * transpose(A);
+    for (Label k = 0; k < stencils.size(); ++k)
+    {
+        const Matrix &A = stencils[k]->A_;
+
+        for (int i = 0; i < 5; ++i)
+            for (int j = 0; j < 5; ++j)
+                for (int l = 0; l < A.m(); ++l)
+                    AtA(k, i, j) += A(l, i) * A(l, j);
+    }
+
+    AtA.invert();
+
+    for (Label k = 0; k < stencils.size(); ++k)
+    {
+        CelesteStencil &st = *stencils[k];
+        st.pInv_ = Matrix(5, st.A_.m());
+
+        for (int i = 0; i < 5; ++i)
+            for (int l = 0; l < st.A_.m(); ++l)
+                for (int j = 0; j < 5; ++j)
+                    st.pInv_(i, l) += AtA(k, i, j) * st.A_(l, j);
+
+        st.A_ = Matrix();
+    }
 }
 
 Vector2D Celeste::CelesteStencil::grad(const ScalarFiniteVolumeField &phi) const
@@ -2,6 +2,7 @@
 #include "FaceInterpolation.h"
 #include "Source.h"
 #include "LeeYou.h"
+#include "Algorithm.h"
 
 FractionalStep::FractionalStep(const Input &input,
                                std::shared_ptr<FiniteVolumeGrid2D> &grid)
@@ -13,7 +14,9 @@ FractionalStep::FractionalStep(const Input &input,
         gradP(addVectorField(std::make_shared<ScalarGradient>(p))),
         gradU(addTensorField(std::make_shared<JacobianField>(u))),
         uEqn_(input, u, "uEqn"),
-        pEqn_(input, p, "pEqn")
+        pEqn_(input, p, "pEqn"),
+        uHalo_(*grid),
+        pHalo_(*grid)
 {
     rho_ = input.caseInput().get<Scalar>("Properties.rho", 1);
     mu_ = input.caseInput().get<Scalar>("Properties.mu", 1);
@@ -24,6 +27,29 @@ FractionalStep::FractionalStep(const Input &input,
 
     //- Create ib zones if any. Will also update local/global indices
     ib_.initCellZones(fluid_);
+
+    adaptivePressureTolerance_ = input.caseInput().get<bool>("Solver.adaptivePressureTolerance", false);
+
+    if (adaptivePressureTolerance_)
+    {
+        divergenceTarget_ = input.caseInput().get<Scalar>("Solver.maxDivergenceError");
+        minPressureTolerance_ = input.caseInput().get<Scalar>("Solver.minPressureTolerance", 1e-12);
+        maxPressureTolerance_ = input.caseInput().get<Scalar>("Solver.maxPressureTolerance", 1e-2);
+
+        if (divergenceTarget_ <= 0. || minPressureTolerance_ <= 0. || minPressureTolerance_ > maxPressureTolerance_)
+            throw Exception("FractionalStep", "FractionalStep", "invalid adaptive pressure tolerance parameters.");
+
+        if (pEqn_.sparseSolver()->tolerance() < 0.)
+        {
+            printf("Pressure solver is direct, its tolerance will not be adapted.\n");
+            adaptivePressureTolerance_ = false;
+        }
+    }
+
+    uHalo_.add(u);
+    pHalo_.add(p);
+    uHalo_.init();
+    pHalo_.init();
 }
 
 void FractionalStep::initialize()
@@ -42,19 +68,29 @@ std::string FractionalStep::info() const
 Scalar FractionalStep::solve(Scalar timeStep)
 {
     solveUEqn(timeStep);
-    solvePEqn(timeStep);
-    correctVelocity(timeStep);
+    solvePEqn(projectionTimeStep(timeStep));
+    correctVelocity(projectionTimeStep(timeStep));
 
-    printf("Max divergence error = %.4e\n", grid_->comm().max(maxDivergenceError()));
-    printf("Max CFL number = %.4lf\n", maxCourantNumber(timeStep));
+    //- Global diagnostics are reduced in one batch while the immersed boundaries are updated
+    ReductionBatch reductions(grid_->comm());
+    reduceStepStatistics(reductions, timeStep);
+    reductions.start();
 
     ib_.update(timeStep);
     ib_.computeForce(rho_, mu_, u, p, g_);
 
+    printf("Max divergence error = %.4e\n", divergenceError_.get());
+    printf("Max CFL number = %.4lf\n", courantNumber_.get());
+
     return 0;
 }
 
 Scalar FractionalStep::maxCourantNumber(Scalar timeStep) const
+{
+    return grid_->comm().max(localMaxCourantNumber(timeStep));
+}
+
+Scalar FractionalStep::localMaxCourantNumber(const VectorFiniteVolumeField &uf, Scalar timeStep) const
 {
     Scalar maxCo = 0;
 
@@ -63,60 +99,85 @@ Scalar FractionalStep::maxCourantNumber(Scalar timeStep) const
         Scalar co = 0.;
 
         for (const InteriorLink &nb: cell.neighbours())
-            co += std::max(dot(u(nb.face()), nb.outwardNorm()), 0.);
+            co += std::max(dot(uf(nb.face()), nb.outwardNorm()), 0.);
 
         for (const BoundaryLink &bd: cell.boundaries())
-            co += std::max(dot(u(bd.face()), bd.outwardNorm()), 0.);
+            co += std::max(dot(uf(bd.face()), bd.outwardNorm()), 0.);
 
         co *= timeStep / cell.volume();
         maxCo = std::max(co, maxCo);
     }
 
-    return grid_->comm().max(maxCo);
+    return maxCo;
 }
 
 Scalar FractionalStep::computeMaxTimeStep(Scalar maxCo, Scalar prevTimeStep) const
 {
-    Scalar co = maxCourantNumber(prevTimeStep);
+    Scalar co = courantNumber_.valid() && prevTimeStep == courantTimeStep_ ?
+                courantNumber_.get() : maxCourantNumber(prevTimeStep);
     Scalar lambda1 = 0.1, lambda2 = 1.2;
 
-    return grid_->comm().min(
-            std::min(
-                    std::min(maxCo / co * prevTimeStep, (1 + lambda1 * maxCo / co) * prevTimeStep),
-                    std::min(lambda2 * prevTimeStep, maxTimeStep_)
-            ));
+    //- All quantities are already global
+    return std::min(
+            std::min(maxCo / co * prevTimeStep, (1 + lambda1 * maxCo / co) * prevTimeStep),
+            std::min(lambda2 * prevTimeStep, maxTimeStep_)
+    );
+}
+
+Solver::StepStatistics FractionalStep::stepStatistics() const
+{
+    StepStatistics stats = Solver::stepStatistics();
+
+    if (courantNumber_.valid())
+        stats.courantNumber = courantNumber_.get();
+
+    if (divergenceError_.valid())
+        stats.divergenceError = std::abs(divergenceError_.get());
+
+    if (velocityChange_.valid() && velocityScale_.get() > 0.)
+        stats.changeError = velocityChange_.get() / velocityScale_.get();
+
+    return stats;
 }
 
 Scalar FractionalStep::solveUEqn(Scalar timeStep)
 {
-    u.savePreviousTimeStep(timeStep, 1);
+    u.savePreviousTimeStep(timeStep, 2);
     //gradU.compute(fluid_);
     //grid_->sendMessages(gradU);
 
-    uEqn_ = (fv::ddt(u, timeStep) + fv::div(u, u, 0) + ib_.velocityBcs(u)
-             == fv::laplacian(mu_ / rho_, u, 0.5));
+    uEqn_ = (fv::ddt(u, timeStep, timeScheme_) + fv::div(u, u, 0) + ib_.velocityBcs(u)
+             == fv::laplacian(mu_ / rho_, u, fv::implicitWeight(timeScheme_, 0.5)));
+
+    //- With the old velocities still in place, only the older time levels of the time derivative enter the residual
+    if (steady_)
+        momentumResidual_ = uEqn_.residualNorm();
 
     Scalar error = uEqn_.solve();
 
     //for (const Cell &cell: fluid_)
     //    u(cell) += timeStep / rho_ * gradP(cell);
 
-    grid_->sendMessages(u);
-    u.interpolateFaces();
+    uHalo_.start();
+    u.interpolateFaces(uHalo_);
 
     return error;
 }
 
 Scalar FractionalStep::solvePEqn(Scalar timeStep)
 {
+    if (steady_)
+        continuityResidual_ = continuityResidualNorm(u, grid().localActiveCells());
+
     pEqn_ = (fv::laplacian(timeStep / rho_, p, grid().localActiveCells()) == src::div(u, grid().localActiveCells()));
 
+    updatePressureTolerance();
     Scalar error = pEqn_.solve();
-    grid_->sendMessages(p);
+    pHalo_.start();
 
     //- Gradient
     p.setBoundaryFaces();
-    gradP.compute(grid().localActiveCells());
+    gradP.compute(pHalo_);
 
     return error;
 }
@@ -126,12 +187,15 @@ void FractionalStep::correctVelocity(Scalar timeStep)
     for (const Cell &cell: grid().localActiveCells())
         u(cell) -= timeStep / rho_ * gradP(cell);
 
-    grid_->sendMessages(u);
+    //- Face corrections do not depend on the buffer zones
+    uHalo_.start();
 
     for (const Face &face: grid_->interiorFaces())
         if(fluid_.isInGroup(face.lCell()) || fluid_.isInGroup(face.rCell()))
         u(face) -= timeStep / rho_ * gradP(face);
 
+    uHalo_.finish();
+
     for (const Patch &patch: grid_->patches())
         switch (u.boundaryType(patch))
         {
@@ -149,6 +213,65 @@ void FractionalStep::correctVelocity(Scalar timeStep)
 }
 
 Scalar FractionalStep::maxDivergenceError()
+{
+    return grid_->comm().max(localMaxDivergenceError());
+}
+
+Scalar FractionalStep::localMaxVelocityChange() const
+{
+    if (!u.hasOldField(1) || u.oldTimeStep(1) <= 0.)
+        return 0.;
+
+    const VectorFiniteVolumeField &u0 = u.oldField(0), &u1 = u.oldField(1);
+    Scalar r = u.oldTimeStep(0) / u.oldTimeStep(1), maxChange = 0.;
+
+    for (const Cell &cell: fluid_)
+        maxChange = std::max((u(cell) - (1. + r) * u0(cell) + r * u1(cell)).mag(), maxChange);
+
+    return maxChange;
+}
+
+Scalar FractionalStep::localMaxVelocity() const
+{
+    Scalar maxU = 0.;
+
+    for (const Cell &cell: fluid_)
+        maxU = std::max(u(cell).mag(), maxU);
+
+    return maxU;
+}
+
+void FractionalStep::reduceStepStatistics(ReductionBatch &reductions, Scalar timeStep)
+{
+    divergenceError_ = reductions.max(localMaxDivergenceError());
+    courantNumber_ = reductions.max(localMaxCourantNumber(timeStep));
+    courantTimeStep_ = timeStep;
+    velocityChange_ = reductions.max(localMaxVelocityChange());
+    velocityScale_ = reductions.max(localMaxVelocity());
+}
+
+void FractionalStep::updatePressureTolerance()
+{
+    if (!adaptivePressureTolerance_ || !divergenceError_.valid())
+        return;
+
+    Scalar error = std::abs(divergenceError_.get());
+    Scalar tolerance = pEqn_.sparseSolver()->tolerance();
+
+    //- The divergence error scales roughly linearly with the solver residual. Tighten at once when the target is
+    //- missed, loosen by at most a factor of 2 and only with a margin, so the tolerance does not oscillate about it
+    if (error > divergenceTarget_)
+        tolerance *= std::max(divergenceTarget_ / error, 0.01);
+    else if (error < 0.5 * divergenceTarget_)
+        tolerance *= error > 0. ? std::min(0.5 * divergenceTarget_ / error, 2.) : 2.;
+
+    tolerance = clamp(tolerance, minPressureTolerance_, maxPressureTolerance_);
+    pEqn_.sparseSolver()->setTolerance(tolerance);
+
+    printf("Pressure solver tolerance = %.2e\n", tolerance);
+}
+
+Scalar FractionalStep::localMaxDivergenceError()
 {
     Scalar maxError = 0.;
 
@@ -162,8 +285,8 @@ Scalar FractionalStep::maxDivergenceError()
         for (const BoundaryLink &bd: cell.boundaries())
             div += dot(u(bd.face()), bd.outwardNorm());
 
-        maxError = fabs(div) > maxError ? div : maxError;
+        maxError = std::max(std::abs(div), maxError);
     }
 
-    return grid_->comm().max(maxError);
+    return maxError;
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "FiniteVolumeEquation.h"
 #include "ScalarGradient.h"
 #include "JacobianField.h"
+#include "ReductionBatch.h"
 
 class FractionalStep: public Solver
 {
@@ -25,6 +26,8 @@ public:
 
     virtual Scalar computeMaxTimeStep(Scalar maxCo, Scalar prevTimeStep) const;
 
+    StepStatistics stepStatistics() const;
+
     VectorFiniteVolumeField &u;
     ScalarFiniteVolumeField &p;
     ScalarGradient &gradP;
@@ -38,7 +41,31 @@ protected:
 
     virtual void correctVelocity(Scalar timeStep);
 
-    virtual Scalar maxDivergenceError();
+    //- Time step scaling the pressure correction, reduced by the leading weight of the time derivative
+    Scalar projectionTimeStep(Scalar timeStep) const
+    { return timeStep / fv::ddtWeights(u, timeStep, timeScheme_)[0]; }
+
+    Scalar localMaxCourantNumber(Scalar timeStep) const
+    { return localMaxCourantNumber(u, timeStep); }
+
+    //- Courant number based on the face velocities of uf
+    Scalar localMaxCourantNumber(const VectorFiniteVolumeField &uf, Scalar timeStep) const;
+
+    Scalar maxDivergenceError();
+
+    virtual Scalar localMaxDivergenceError();
+
+    //- Deviation of the new velocities from a linear extrapolation of the previous two steps, an estimate of the
+    //- local time integration error
+    Scalar localMaxVelocityChange() const;
+
+    Scalar localMaxVelocity() const;
+
+    //- Enqueue the step diagnostics in a reduction batch
+    virtual void reduceStepStatistics(ReductionBatch &reductions, Scalar timeStep);
+
+    //- Adapts the pressure solver tolerance to the divergence error of the last step, no-op unless enabled
+    void updatePressureTolerance();
 
     Equation<Vector2D> uEqn_;
     Equation<Scalar> pEqn_;
@@ -47,6 +74,19 @@ protected:
     Vector2D g_;
 
     CellZone &fluid_;
+
+    //- Courant number of the last step, reused when computing the next time step
+    ReductionBatch::Result courantNumber_;
+    Scalar courantTimeStep_ = 0.;
+
+    ReductionBatch::Result divergenceError_, velocityChange_, velocityScale_;
+
+    //- Inexact projection, the pressure is solved only as accurately as the divergence target requires
+    bool adaptivePressureTolerance_;
+    Scalar divergenceTarget_, minPressureTolerance_, maxPressureTolerance_;
+
+    //- Persistent halo exchanges
+    HaloExchange uHalo_, pHalo_;
 };
 
 #endif
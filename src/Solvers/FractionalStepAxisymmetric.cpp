@@ -26,6 +26,7 @@ Scalar FractionalStepAxisymmetric::solveUEqn(Scalar timeStep)
 Scalar FractionalStepAxisymmetric::solvePEqn(Scalar timeStep)
 {
     pEqn_ = (axi::laplacian(timeStep / rho_, p) == axi::src::div(u));
+    updatePressureTolerance();
     Scalar error = pEqn_.solve();
 
     p.interpolateFaces();
@@ -58,7 +59,7 @@ void FractionalStepAxisymmetric::correctVelocity(Scalar timeStep)
         }
 }
 
-Scalar FractionalStepAxisymmetric::maxDivergenceError()
+Scalar FractionalStepAxisymmetric::localMaxDivergenceError()
 {
     Scalar maxError = 0.;
 
@@ -74,5 +75,5 @@ Scalar FractionalStepAxisymmetric::maxDivergenceError()
         maxError = std::abs(divU) > maxError ? std::abs(divU) : maxError;
     }
 
-    return grid_->comm().max(maxError);
+    return maxError;
 }
\ No newline at end of file
@@ -18,7 +18,7 @@ protected:
 
     void correctVelocity(Scalar timeStep);
 
-    Scalar maxDivergenceError();
+    Scalar localMaxDivergenceError();
 };
 
 
@@ -40,8 +40,8 @@ std::string FractionalStepIncremental::info() const
 Scalar FractionalStepIncremental::solve(Scalar timeStep)
 {
     solveUEqn(timeStep);
-    solvePEqn(timeStep);
-    correctVelocity(timeStep);
+    solvePEqn(projectionTimeStep(timeStep));
+    correctVelocity(projectionTimeStep(timeStep));
 
     //ib_.update(timeStep);
 
@@ -62,22 +62,26 @@ void FractionalStepIncremental::restartSolution()
 
 Scalar FractionalStepIncremental::solveUEqn(Scalar timeStep)
 {
-    u.savePreviousTimeStep(timeStep, 1);
-    uEqn_ = (fv::ddt(u, timeStep) + fv::div(u, u, 0.5) + ib_.velocityBcs(u)
-             == fv::laplacian(mu_ / rho_, u, 0.5) - src::src(gradP / rho_, fluid_));
+    u.savePreviousTimeStep(timeStep, 2);
+    uEqn_ = (fv::ddt(u, timeStep, timeScheme_) + fv::div(u, u, fv::implicitWeight(timeScheme_, 0.5))
+             + ib_.velocityBcs(u)
+             == fv::laplacian(mu_ / rho_, u, fv::implicitWeight(timeScheme_, 0.5)) - src::src(gradP / rho_, fluid_));
 
     Scalar error = uEqn_.solve();
     grid_->sendMessages(u);
 
+    //- Face velocities are reconstructed with the pressure gradient removed over the projection time step
+    Scalar projTimeStep = projectionTimeStep(timeStep);
+
     for (const Face &f: grid_->interiorFaces())
     {
         const Cell &l = f.lCell();
         const Cell &r = f.rCell();
         Scalar g = f.volumeWeight();
 
-        u(f) = g * (u(l) + timeStep / rho_ * gradP(l))
-               + (1. - g) * (u(r) + timeStep / rho_ * gradP(r))
-               - timeStep / rho_ * gradP(f);
+        u(f) = g * (u(l) + projTimeStep / rho_ * gradP(l))
+               + (1. - g) * (u(r) + projTimeStep / rho_ * gradP(r))
+               - projTimeStep / rho_ * gradP(f);
     }
 
     for (const Patch &patch: grid_->patches())
@@ -87,7 +91,7 @@ Scalar FractionalStepIncremental::solveUEqn(Scalar timeStep)
                 break;
             case VectorFiniteVolumeField::NORMAL_GRADIENT:
                 for (const Face &face: patch)
-                    u(face) = u(face.lCell()) + timeStep / rho_ * (gradP(face.lCell()) - gradP(face));
+                    u(face) = u(face.lCell()) + projTimeStep / rho_ * (gradP(face.lCell()) - gradP(face));
                 break;
             case VectorFiniteVolumeField::SYMMETRY:
                 for (const Face &face: patch)
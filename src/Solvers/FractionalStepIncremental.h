@@ -40,6 +40,10 @@ protected:
 
     virtual void correctVelocity(Scalar timeStep);
 
+    //- Time step scaling the pressure correction, reduced by the leading weight of the time derivative
+    Scalar projectionTimeStep(Scalar timeStep) const
+    { return timeStep / fv::ddtWeights(u, timeStep, timeScheme_)[0]; }
+
     Scalar maxDivergenceError() const;
 
     Scalar rho_, mu_;
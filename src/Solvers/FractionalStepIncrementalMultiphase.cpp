@@ -61,8 +61,8 @@ Scalar FractionalStepIncrementalMultiphase::solve(Scalar timeStep)
 {
     solveGammaEqn(timeStep); //- Solve a sharp gamma equation
     solveUEqn(timeStep); //- Solve a momentum prediction
-    solvePEqn(timeStep); //- Solve the pressure equation, using sharp value of rho
-    correctVelocity(timeStep);
+    solvePEqn(projectionTimeStep(timeStep)); //- Solve the pressure equation, using sharp value of rho
+    correctVelocity(projectionTimeStep(timeStep));
 
     grid_->comm().printf("Max Co = %lf\n", maxCourantNumber(timeStep));
     grid_->comm().printf("Max absolute velocity divergence error = %.4e\n", maxDivergenceError());
@@ -135,22 +135,26 @@ Scalar FractionalStepIncrementalMultiphase::solveUEqn(Scalar timeStep)
 
     gradP.faceToCell(rho, rho.oldField(0), fluid_);
 
-    u.savePreviousTimeStep(timeStep, 1);
-    uEqn_ = (fv::ddt(rho, u, timeStep) + fv::div(rhoU, u, 0.5) + ib_.velocityBcs(u)
-             == fv::laplacian(mu, u, 0.5) - src::src(gradP - sg0 - ft0, fluid_));
+    u.savePreviousTimeStep(timeStep, 2);
+    uEqn_ = (fv::ddt(rho, u, timeStep, timeScheme_) + fv::div(rhoU, u, fv::implicitWeight(timeScheme_, 0.5))
+             + ib_.velocityBcs(u)
+             == fv::laplacian(mu, u, fv::implicitWeight(timeScheme_, 0.5)) - src::src(gradP - sg0 - ft0, fluid_));
 
     Scalar error = uEqn_.solve();
     grid_->sendMessages(u);
 
+    //- Face velocities are reconstructed with the pressure gradient removed over the projection time step
+    Scalar projTimeStep = projectionTimeStep(timeStep);
+
     for (const Face &f: grid_->interiorFaces())
     {
         Scalar g = f.volumeWeight();
         const Cell &l = f.lCell();
         const Cell &r = f.rCell();
 
-        u(f) = g * (u(l) + timeStep / rho(l) * (gradP(l) - sg0(l) - ft0(l)))
-               + (1. - g) * (u(r) + timeStep / rho(r) * (gradP(r) - sg0(r) - ft0(r)))
-               - timeStep / rho(f) * (gradP(f) - sg(f) - ft(f));
+        u(f) = g * (u(l) + projTimeStep / rho(l) * (gradP(l) - sg0(l) - ft0(l)))
+               + (1. - g) * (u(r) + projTimeStep / rho(r) * (gradP(r) - sg0(r) - ft0(r)))
+               - projTimeStep / rho(f) * (gradP(f) - sg(f) - ft(f));
     }
 
     for (const Patch &patch: u.grid().patches())
@@ -162,8 +166,8 @@ Scalar FractionalStepIncrementalMultiphase::solveUEqn(Scalar timeStep)
                 for (const Face &f: patch)
                 {
                     const Cell &l = f.lCell();
-                    u(f) = u(l) + timeStep / rho(l) * (gradP(l) - sg0(l) - ft0(l))
-                           - timeStep / rho(f) * (gradP(f) - sg(f) - ft(f));
+                    u(f) = u(l) + projTimeStep / rho(l) * (gradP(l) - sg0(l) - ft0(l))
+                           - projTimeStep / rho(f) * (gradP(f) - sg(f) - ft(f));
                 }
                 break;
             case VectorFiniteVolumeField::SYMMETRY:
@@ -226,7 +230,7 @@ void FractionalStepIncrementalMultiphase::correctVelocity(Scalar timeStep)
 void FractionalStepIncrementalMultiphase::updateProperties(Scalar timeStep)
 {
     //- Update density
-    rho.savePreviousTimeStep(timeStep, 1);
+    rho.savePreviousTimeStep(timeStep, 2);
     rho.computeCells([this](const Cell &cell) {
         Scalar g = gamma(cell);
         return (1. - g) * rho1_ + g * rho2_;
@@ -2,6 +2,7 @@
 #include "Source.h"
 #include "Cicsam.h"
 #include "Hric.h"
+#include "Plic.h"
 #include "SeoMittal.h"
 #include "Algorithm.h"
 
@@ -17,13 +18,59 @@ FractionalStepMultiphase::FractionalStepMultiphase(const Input &input,
         sg(addVectorField("sg")),
         gradGamma(addVectorField(std::make_shared<ScalarGradient>(gamma))),
         gradRho(addVectorField(std::make_shared<ScalarGradient>(rho))),
-        gammaEqn_(input, gamma, "gammaEqn")
+        gammaEqn_(input, gamma, "gammaEqn"),
+        beta_(grid, "beta"),
+        gammaF_(grid, "gammaF"),
+        gammaHalo_(*grid),
+        propertyHalo_(*grid)
 {
     rho1_ = input.caseInput().get<Scalar>("Properties.rho1", rho_);
     rho2_ = input.caseInput().get<Scalar>("Properties.rho2", rho_);
     mu1_ = input.caseInput().get<Scalar>("Properties.mu1", mu_);
     mu2_ = input.caseInput().get<Scalar>("Properties.mu2", mu_);
 
+    const std::string advection = input.caseInput().get<std::string>("Solver.interfaceAdvection", "cicsam");
+
+    if (advection == "cicsam")
+        interfaceAdvectionMethod_ = CICSAM;
+    else if (advection == "hric")
+        interfaceAdvectionMethod_ = HRIC;
+    else if (advection == "plic")
+        interfaceAdvectionMethod_ = PLIC;
+    else
+        throw Exception("FractionalStepMultiphase", "FractionalStepMultiphase",
+                        "unrecognized interface advection method \"" + advection + "\".");
+
+    //- Volume fractions are sub-cycled within each flow step if they have their own Courant limit. PLIC is only
+    //- bounded up to an interface Courant number of 0.5, so it is always sub-cycled
+    interfaceMaxCo_ = input.caseInput().get<Scalar>("Solver.interfaceMaxCo",
+                                                    interfaceAdvectionMethod_ == PLIC
+                                                    ? plic::courantLimit : std::numeric_limits<Scalar>::infinity());
+
+    if (interfaceMaxCo_ <= 0.)
+        throw Exception("FractionalStepMultiphase", "FractionalStepMultiphase",
+                        "interface Courant number limit must be positive.");
+
+    if (interfaceAdvectionMethod_ == PLIC && interfaceMaxCo_ > plic::courantLimit)
+        throw Exception("FractionalStepMultiphase", "FractionalStepMultiphase",
+                        "interface Courant number limit of PLIC may not exceed 0.5.");
+
+    const std::string surfaceTension = input.caseInput().get<std::string>("Solver.surfaceTension", "explicit");
+
+    if (surfaceTension == "explicit")
+        semiImplicitSurfaceTension_ = false;
+    else if (surfaceTension == "semiImplicit")
+        semiImplicitSurfaceTension_ = true;
+    else
+        throw Exception("FractionalStepMultiphase", "FractionalStepMultiphase",
+                        "unrecognized surface tension treatment \"" + surfaceTension + "\".");
+
+    capillaryTimeStepFactor_ = input.caseInput().get<Scalar>("Solver.capillaryTimeStepFactor", 1.);
+
+    if (capillaryTimeStepFactor_ <= 0.)
+        throw Exception("FractionalStepMultiphase", "FractionalStepMultiphase",
+                        "capillary time step factor must be positive.");
+
     capillaryTimeStep_ = std::numeric_limits<Scalar>::infinity();
     for (const Face &face: grid_->interiorFaces())
     {
@@ -32,7 +79,13 @@ FractionalStepMultiphase::FractionalStepMultiphase(const Input &input,
                                       sqrt(((rho1_ + rho2_) * delta * delta * delta) / (4 * M_PI * ft.sigma())));
     }
 
-    capillaryTimeStep_ = grid_->comm().min(capillaryTimeStep_);
+    capillaryTimeStep_ = capillaryTimeStepFactor_ * grid_->comm().min(capillaryTimeStep_);
+
+    gammaHalo_.add(gamma);
+    propertyHalo_.add(rho);
+    propertyHalo_.add(mu);
+    gammaHalo_.init();
+    propertyHalo_.init();
 }
 
 void FractionalStepMultiphase::initialize()
@@ -52,18 +105,38 @@ Scalar FractionalStepMultiphase::computeMaxTimeStep(Scalar maxCo, Scalar prevTim
     return std::min(FractionalStep::computeMaxTimeStep(maxCo, prevTimeStep), capillaryTimeStep_);
 }
 
+Scalar FractionalStepMultiphase::maxStableTimeStep() const
+{
+    return std::min(FractionalStep::maxStableTimeStep(), capillaryTimeStep_);
+}
+
+Solver::StepStatistics FractionalStepMultiphase::stepStatistics() const
+{
+    StepStatistics stats = FractionalStep::stepStatistics();
+
+    //- Volume fractions are already normalized
+    if (gammaChange_.valid())
+        stats.changeError = std::max(stats.changeError, gammaChange_.get());
+
+    return stats;
+}
+
 Scalar FractionalStepMultiphase::solve(Scalar timeStep)
 {
     solveGammaEqn(timeStep);
     solveUEqn(timeStep);
-    solvePEqn(timeStep);
-    correctVelocity(timeStep);
+    solvePEqn(projectionTimeStep(timeStep));
+    correctVelocity(projectionTimeStep(timeStep));
+
+    ReductionBatch reductions(grid_->comm());
+    reduceStepStatistics(reductions, timeStep);
+    reductions.start();
 
     //ib_.computeForce(rho, mu, u, p, g_);
     ib_.update(timeStep);
 
-    printf("Max divergence error = %.4e\n", grid_->comm().max(maxDivergenceError()));
-    printf("Max CFL number = %.4lf\n", maxCourantNumber(timeStep));
+    printf("Max divergence error = %.4e\n", divergenceError_.get());
+    printf("Max CFL number = %.4lf\n", courantNumber_.get());
 
     return 0;
 }
@@ -72,38 +145,206 @@ Scalar FractionalStepMultiphase::solve(Scalar timeStep)
 
 Scalar FractionalStepMultiphase::solveGammaEqn(Scalar timeStep)
 {
-    auto beta = cicsam::beta(u, gradGamma, gamma, timeStep, 0.5);
+    if (!std::isinf(interfaceMaxCo_))
+        return solveSubCycledGammaEqn(timeStep);
+
+    computeBeta(u, timeStep);
 
     //- Advect volume fractions
-    gamma.savePreviousTimeStep(timeStep, 1);
-    gammaEqn_ = (fv::ddt(gamma, timeStep) + cicsam::div(u, beta, gamma, 0.5)
+    gamma.savePreviousTimeStep(timeStep, 2);
+    gammaEqn_ = (fv::ddt(gamma, timeStep) + cicsam::div(u, beta_, gammaF_, gamma, fluid_, 0.5)
                  == ft.contactLineBcs(ib_));
 
     Scalar error = gammaEqn_.solve();
-    grid_->sendMessages(gamma);
-    gamma.interpolateFaces();
+    gammaHalo_.start();
+    gamma.interpolateFaces(gammaHalo_);
 
     //- Update the gradient
     gradGamma.compute(fluid_);
     grid_->sendMessages(gradGamma);
 
     //- Update all other properties
-    computeMomentumFlux(beta, timeStep);
+    computeMomentumFlux(timeStep);
+    updateProperties(timeStep);
+
+    return error;
+}
+
+Scalar FractionalStepMultiphase::solveSubCycledGammaEqn(Scalar timeStep)
+{
+    Scalar prevTimeStep = u.oldTimeStep(0);
+    Scalar sEnd = prevTimeStep > 0. ? timeStep / prevTimeStep : 0.;
+
+    VectorFiniteVolumeField uf(grid_, "uf");
+
+    //- The pressure solve runs at the flow time step, volume fractions take as many steps as their own limit needs.
+    //- The sub-cycles advect with face velocities extrapolated in time, and the outflow of a cell is convex in the
+    //- extrapolation, so its largest value over the step is at one of the ends
+    for (const Face &face: grid_->faces())
+        uf(face) = u(face) + sEnd * (u(face) - u.oldField(0)(face));
+
+    Scalar maxCo = grid_->comm().max(std::max(localMaxCourantNumber(timeStep), localMaxCourantNumber(uf, timeStep)));
+    Size nSubCycles = (Size) std::max(std::ceil(maxCo / interfaceMaxCo_), 1.);
+    Scalar subTimeStep = timeStep / nSubCycles;
+
+    gamma.savePreviousTimeStep(timeStep, 2);
+
+    //- The face values of each sub-cycle are averaged, and also weighted by the flux of the sub-cycle. The weighted
+    //- average together with the mean face velocity carries the same mass as the sub-cycles
+    ScalarFiniteVolumeField faceGamma(grid_, "faceGamma", 0.), phaseFlux(grid_, "phaseFlux", 0.),
+            absFlux(grid_, "absFlux", 0.);
+    VectorFiniteVolumeField ufMean(grid_, "ufMean", Vector2D(0., 0.));
+    Scalar error = 0.;
+
+    for (Size i = 0; i < nSubCycles; ++i)
+    {
+        //- Face velocities vary linearly in time through the previous and current velocity levels
+        Scalar s = prevTimeStep > 0. ? (i + 0.5) * subTimeStep / prevTimeStep : 0.;
+
+        for (const Face &face: grid_->faces())
+        {
+            uf(face) = u(face) + s * (u(face) - u.oldField(0)(face));
+            ufMean(face) += uf(face) / nSubCycles;
+            absFlux(face) += std::abs(dot(uf(face), face.outwardNorm())) / nSubCycles;
+        }
+
+        if (interfaceAdvectionMethod_ == PLIC)
+        {
+            auto fraction = plic::advect(uf, gradGamma, gamma, subTimeStep, fluid_);
+
+            for (const Face &face: grid_->faces())
+            {
+                faceGamma(face) += fraction(face) / nSubCycles;
+                phaseFlux(face) += fraction(face) * dot(uf(face), face.outwardNorm()) / nSubCycles;
+            }
+
+            error = std::max(error, solveGammaBcs());
+
+            gammaHalo_.start();
+            gamma.interpolateFaces(gammaHalo_);
+        }
+        else
+        {
+            computeBeta(uf, subTimeStep);
+
+            //- Face values are averaged between the start and end of each sub-cycle, as in the Crank-Nicolson update
+            Scalar w = 0.5 / nSubCycles;
+
+            for (const Face &f: grid_->interiorFaces())
+            {
+                faceGamma(f) += w * gammaF_(f);
+                phaseFlux(f) += w * gammaF_(f) * dot(uf(f), f.outwardNorm());
+            }
+
+            for (const Face &f: grid_->boundaryFaces())
+            {
+                faceGamma(f) += w * gamma(f);
+                phaseFlux(f) += w * gamma(f) * dot(uf(f), f.outwardNorm());
+            }
+
+            gammaEqn_ = (fv::ddt(gamma, subTimeStep) + cicsam::div(uf, beta_, gammaF_, gamma, fluid_, 0.5)
+                         == ft.contactLineBcs(ib_));
+
+            error = std::max(error, gammaEqn_.solve());
+            gammaHalo_.start();
+            gamma.interpolateFaces(gammaHalo_);
+
+            for (const Face &f: grid_->interiorFaces())
+            {
+                Scalar flux = dot(uf(f), f.outwardNorm());
+                const Cell &d = flux > 0. ? f.lCell() : f.rCell();
+                const Cell &a = flux > 0. ? f.rCell() : f.lCell();
+                Scalar g = (1. - beta_(f)) * gamma(d) + beta_(f) * gamma(a);
+
+                faceGamma(f) += w * g;
+                phaseFlux(f) += w * g * flux;
+            }
+
+            for (const Face &f: grid_->boundaryFaces())
+            {
+                faceGamma(f) += w * gamma(f);
+                phaseFlux(f) += w * gamma(f) * dot(uf(f), f.outwardNorm());
+            }
+        }
+
+        gradGamma.compute(fluid_);
+        grid_->sendMessages(gradGamma);
+    }
+
+    printf("Volume fraction sub-cycles = %d\n", (int) nSubCycles);
+
+    //- The flux weighted value is bounded if the flux keeps its sign over the step. Otherwise the plain average is
+    //- kept, the net flux of such a face is small
+    for (const Face &face: grid_->faces())
+    {
+        Scalar flux = dot(ufMean(face), face.outwardNorm());
+
+        if (absFlux(face) > 0. && std::abs(flux) >= (1. - 1e-12) * absFlux(face))
+            faceGamma(face) = phaseFlux(face) / flux;
+    }
+
+    //- Update all other properties
+    computeAveragedMomentumFlux(faceGamma, ufMean, timeStep);
     updateProperties(timeStep);
 
     return error;
 }
 
+Scalar FractionalStepMultiphase::solveGammaBcs()
+{
+    if (ib_.ibObjPtrs().empty())
+        return 0.;
+
+    Equation<Scalar> fluidEqn(gamma);
+
+    for (const Cell &cell: fluid_)
+    {
+        fluidEqn.add(cell, cell, 1.);
+        fluidEqn.addSource(cell, -gamma(cell));
+    }
+
+    gammaEqn_ = (fluidEqn == ft.contactLineBcs(ib_));
+
+    return gammaEqn_.solve();
+}
+
 Scalar FractionalStepMultiphase::solveUEqn(Scalar timeStep)
 {
-    u.savePreviousTimeStep(timeStep, 1);
-    uEqn_ = (fv::ddt(rho, u, timeStep) + fv::div(rhoU, u, 0.) + ib_.bcs(u)
-             == fv::laplacian(mu, u, 0.5));
+    u.savePreviousTimeStep(timeStep, 2);
+    uEqn_ = (fv::ddt(rho, u, timeStep, timeScheme_) + fv::div(rhoU, u, 0.) + ib_.bcs(u)
+             == fv::laplacian(mu, u, fv::implicitWeight(timeScheme_, 0.5)));
+
+    if (semiImplicitSurfaceTension_)
+    {
+        uEqn_ -= src::src(ft, fluid_);
+        uEqn_ -= ft.laplaceBeltrami(u, timeStep);
+    }
 
     Scalar error = uEqn_.solve();
-    grid_->sendMessages(u);
+    uHalo_.start();
+
+    u.interpolateFaces(uHalo_);
+
+    if (!semiImplicitSurfaceTension_)
+        return error;
 
-    u.interpolateFaces();
+    //- The interpolated cell force is replaced by the face force, so that it enters the projection with the same
+    //- discretization as the pressure gradient and both balance at equilibrium
+    Scalar projTimeStep = projectionTimeStep(timeStep);
+
+    for (const Face &f: grid_->interiorFaces())
+    {
+        Scalar g = f.volumeWeight();
+        const Cell &l = f.lCell();
+        const Cell &r = f.rCell();
+
+        u(f) += projTimeStep * (ft(f) / rho(f) - g * ft(l) / rho(l) - (1. - g) * ft(r) / rho(r));
+    }
+
+    for (const Patch &patch: grid_->patches())
+        if (u.boundaryType(patch) == VectorFiniteVolumeField::NORMAL_GRADIENT)
+            for (const Face &f: patch)
+                u(f) += projTimeStep * (ft(f) / rho(f) - ft(f.lCell()) / rho(f.lCell()));
 
     return error;
 }
@@ -112,6 +353,7 @@ Scalar FractionalStepMultiphase::solvePEqn(Scalar timeStep)
 {
     pEqn_ = (fv::laplacian(timeStep / rho, p, fluid_) + ib_.bcs(p) == src::div(u, fluid_));
 
+    updatePressureTolerance();
     Scalar error = pEqn_.solve();
     grid_->sendMessages(p);
 
@@ -140,84 +382,157 @@ void FractionalStepMultiphase::correctVelocity(Scalar timeStep)
         u(cell) -= timeStep / rho(cell) * gradP(cell);
 }
 
-void FractionalStepMultiphase::computeMomentumFlux(const ScalarFiniteVolumeField &beta, Scalar timeStep)
+Scalar FractionalStepMultiphase::localMaxGammaChange() const
 {
-    rhoU.savePreviousTimeStep(timeStep, 1);
+    if (!gamma.hasOldField(1) || gamma.oldTimeStep(1) <= 0.)
+        return 0.;
 
-    rhoU.oldField(0).computeInteriorFaces([this, &beta](const Face &f) {
-        Scalar flux = dot(u(f), f.outwardNorm());
-        const Cell &d = flux > 0. ? f.lCell() : f.rCell();
-        const Cell &a = flux > 0. ? f.rCell() : f.lCell();
-        Scalar g = (1. - beta(f)) * gamma.oldField(0)(d) + beta(f) * gamma.oldField(0)(a);
-        return ((1. - g) * rho1_ + g * rho2_) * u(f);
-    });
+    const ScalarFiniteVolumeField &gamma0 = gamma.oldField(0), &gamma1 = gamma.oldField(1);
+    Scalar r = gamma.oldTimeStep(0) / gamma.oldTimeStep(1), maxChange = 0.;
 
-    rhoU.oldField(0).computeBoundaryFaces([this, &beta](const Face &f) {
-        Scalar g = gamma.oldField(0)(f);
-        return ((1. - g) * rho1_ + g * rho2_) * u(f);
-    });
+    for (const Cell &cell: fluid_)
+        maxChange = std::max(std::abs(gamma(cell) - (1. + r) * gamma0(cell) + r * gamma1(cell)), maxChange);
 
-    rhoU.computeInteriorFaces([this, &beta](const Face &f) {
-        Scalar flux = dot(u(f), f.outwardNorm());
-        const Cell &d = flux > 0. ? f.lCell() : f.rCell();
-        const Cell &a = flux > 0. ? f.rCell() : f.lCell();
-        Scalar g = (1. - beta(f)) * gamma(d) + beta(f) * gamma(a);
-        return ((1. - g) * rho1_ + g * rho2_) * u(f);
-    });
+    return maxChange;
+}
 
-    rhoU.computeBoundaryFaces([this](const Face &f) {
-        Scalar g = gamma(f);
-        return ((1. - g) * rho1_ + g * rho2_) * u(f);
-    });
+void FractionalStepMultiphase::reduceStepStatistics(ReductionBatch &reductions, Scalar timeStep)
+{
+    FractionalStep::reduceStepStatistics(reductions, timeStep);
+    gammaChange_ = reductions.max(localMaxGammaChange());
 }
 
-void FractionalStepMultiphase::updateProperties(Scalar timeStep)
+void FractionalStepMultiphase::computeBeta(const VectorFiniteVolumeField &uf, Scalar timeStep)
 {
-    //- Update density, density gradient and gravity source
-    rho.savePreviousTimeStep(timeStep, 1);
-    rho.computeCells([this](const Cell &c) {
-        Scalar g = gamma(c);
-        return (1. - g) * rho1_ + g * rho2_;
-    });
+    if (interfaceAdvectionMethod_ == HRIC)
+        hric::beta(uf, gradGamma, gamma, timeStep, beta_, gammaF_);
+    else
+        cicsam::beta(uf, gradGamma, gamma, timeStep, beta_, gammaF_, 0.5);
+}
 
-    grid_->sendMessages(rho);
+void FractionalStepMultiphase::computeMomentumFlux(Scalar timeStep)
+{
+    const ScalarFiniteVolumeField &beta = beta_;
+    const ScalarFiniteVolumeField &gamma0 = gamma.oldField(0);
 
-    rho.computeFaces([this](const Face &f) {
-        Scalar g = gamma(f);
-        return (1. - g) * rho1_ + g * rho2_;
-    });
+    rhoU.savePreviousTimeStep(timeStep, 1);
+    VectorFiniteVolumeField &rhoU0 = rhoU.oldField(0);
 
-    gradRho.computeFaces();
+    //- Old and new fluxes in one face pass. The interior face volume fractions before advection were already
+    //- computed by the face kernel
+    const std::vector<Face> &faces = grid_->faces();
 
-    //- Update the gravitational source term
-    sg.savePreviousTimeStep(timeStep, 1.);
-    for (const Face &face: grid().faces())
-        sg(face) = dot(g_, -face.centroid()) * gradRho(face);
+#pragma omp parallel for
+    for (int i = 0; i < faces.size(); ++i)
+    {
+        const Face &f = faces[i];
+        Scalar g0, g;
+
+        if (f.isBoundary())
+        {
+            g0 = gamma0(f);
+            g = gamma(f);
+        }
+        else
+        {
+            Scalar flux = dot(u(f), f.outwardNorm());
+            const Cell &d = flux > 0. ? f.lCell() : f.rCell();
+            const Cell &a = flux > 0. ? f.rCell() : f.lCell();
+
+            g0 = gammaF_(f);
+            g = (1. - beta(f)) * gamma(d) + beta(f) * gamma(a);
+        }
+
+        rhoU0(f) = ((1. - g0) * rho1_ + g0 * rho2_) * u(f);
+        rhoU(f) = ((1. - g) * rho1_ + g * rho2_) * u(f);
+    }
+}
 
-    sg.oldField(0).faceToCell(rho, rho.oldField(0), fluid_);
-    sg.faceToCell(rho, rho, fluid_);
+void FractionalStepMultiphase::computeAveragedMomentumFlux(const ScalarFiniteVolumeField &faceGamma,
+                                                           const VectorFiniteVolumeField &uf,
+                                                           Scalar timeStep)
+{
+    //- The face values are averaged over the step, so the old and new fluxes coincide
+    rhoU.savePreviousTimeStep(timeStep, 1);
 
-    //- Update viscosity
-    mu.savePreviousTimeStep(timeStep, 1);
-    mu.computeCells([this](const Cell &cell) {
-        Scalar g = clamp(gamma(cell), 0., 1.);
-        return rho(cell) / ((1. - g) * rho1_ / mu1_ + g * rho2_ / mu2_);
+    rhoU.computeFaces([this, &faceGamma, &uf](const Face &f) {
+        Scalar g = faceGamma(f);
+        return ((1. - g) * rho1_ + g * rho2_) * uf(f);
     });
 
-    grid_->sendMessages(mu);
+    for (const Face &face: grid_->faces())
+        rhoU.oldField(0)(face) = rhoU(face);
+}
 
-    mu.computeFaces([this](const Face &f) {
+void FractionalStepMultiphase::updateProperties(Scalar timeStep)
+{
+    rho.savePreviousTimeStep(timeStep, 2);
+    mu.savePreviousTimeStep(timeStep, 1);
+    sg.savePreviousTimeStep(timeStep, 1);
+
+    //- Cell densities and viscosities in one pass, then communicated at once
+    const std::vector<Cell> &cells = grid_->cells();
+
+#pragma omp parallel for
+    for (int i = 0; i < cells.size(); ++i)
+    {
+        const Cell &c = cells[i];
+        Scalar g = gamma(c), gc = clamp(g, 0., 1.);
+
+        rho(c) = (1. - g) * rho1_ + g * rho2_;
+        mu(c) = rho(c) / ((1. - gc) * rho1_ / mu1_ + gc * rho2_ / mu2_);
+    }
+
+    propertyHalo_.exchange();
+
+    //- Face densities, density gradients, gravitational source and viscosities in one pass
+    const std::vector<Face> &faces = grid_->faces();
+
+#pragma omp parallel for
+    for (int i = 0; i < faces.size(); ++i)
+    {
+        const Face &f = faces[i];
         Scalar g = gamma(f);
-        return rho(f) / ((1. - g) * rho1_ / mu1_ + g * rho2_ / rho2_);
-    });
 
-    mu.interpolateFaces();
+        rho(f) = (1. - g) * rho1_ + g * rho2_;
+
+        if (f.isBoundary())
+        {
+            Vector2D rf = f.centroid() - f.lCell().centroid();
+            gradRho(f) = (rho(f) - rho(f.lCell())) * rf / dot(rf, rf);
+
+            switch (mu.boundaryType(f))
+            {
+                case ScalarFiniteVolumeField::NORMAL_GRADIENT:
+                case ScalarFiniteVolumeField::SYMMETRY:
+                    mu(f) = mu(f.lCell());
+                    break;
+                default:
+                    break;
+            }
+        }
+        else
+        {
+            Vector2D rc = f.rCell().centroid() - f.lCell().centroid();
+            gradRho(f) = (rho(f.rCell()) - rho(f.lCell())) * rc / dot(rc, rc);
+
+            Scalar w = f.volumeWeight();
+            mu(f) = w * mu(f.lCell()) + (1. - w) * mu(f.rCell());
+        }
+
+        sg(f) = dot(g_, -f.centroid()) * gradRho(f);
+    }
+
+    //- Old cell values of the forces were saved with the old densities and need no update
+    sg.faceToCell(rho, rho, fluid_);
 
-    //- Update surface tension force
-//    ft.savePreviousTimeStep(timeStep, 1);
-//    ft.computeFaces(ib_);
-//    ft.oldField(0).faceToCell(rho, rho.oldField(0), fluid_);
-//    ft.faceToCell(rho, rho, fluid_);
+    //- Update surface tension force, it is only applied with the semi-implicit treatment
+    if (semiImplicitSurfaceTension_)
+    {
+        ft.savePreviousTimeStep(timeStep, 1);
+        ft.computeFaces(ib_);
+        ft.faceToCell(rho, rho, fluid_);
+    }
 
     //ft.compute(ib_);
 }
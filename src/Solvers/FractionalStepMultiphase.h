@@ -3,10 +3,17 @@
 
 #include "FractionalStep.h"
 #include "Celeste.h"
+#include "HaloExchange.h"
 
 class FractionalStepMultiphase : public FractionalStep
 {
 public:
+
+    enum InterfaceAdvection
+    {
+        CICSAM, HRIC, PLIC
+    };
+
     FractionalStepMultiphase(const Input &input,
                              std::shared_ptr<FiniteVolumeGrid2D> &grid);
 
@@ -14,6 +21,10 @@ public:
 
     Scalar computeMaxTimeStep(Scalar maxCo, Scalar prevTimeStep) const;
 
+    Scalar maxStableTimeStep() const;
+
+    StepStatistics stepStatistics() const;
+
     virtual Scalar solve(Scalar timeStep);
 
     ScalarFiniteVolumeField &rho, &mu, &gamma;
@@ -25,21 +36,54 @@ protected:
 
     virtual Scalar solveGammaEqn(Scalar timeStep);
 
+    Scalar solveSubCycledGammaEqn(Scalar timeStep);
+
+    //- With the fluid cells already advected explicitly, solve for the immersed boundary cells only
+    Scalar solveGammaBcs();
+
     virtual Scalar solveUEqn(Scalar timeStep);
 
     virtual Scalar solvePEqn(Scalar timeStep);
 
     virtual void correctVelocity(Scalar timeStep);
 
-    void computeMomentumFlux(const ScalarFiniteVolumeField &beta, Scalar timeStep);
+    //- Fused face kernel of the selected algebraic scheme, fills beta_ and gammaF_
+    void computeBeta(const VectorFiniteVolumeField &uf, Scalar timeStep);
+
+    void computeMomentumFlux(Scalar timeStep);
+
+    //- Momentum flux from face volume fractions and face velocities averaged over the time step
+    void computeAveragedMomentumFlux(const ScalarFiniteVolumeField &faceGamma,
+                                     const VectorFiniteVolumeField &uf,
+                                     Scalar timeStep);
 
     void updateProperties(Scalar timeStep);
 
+    Scalar localMaxGammaChange() const;
+
+    void reduceStepStatistics(ReductionBatch &reductions, Scalar timeStep);
+
     //- Properties
     Scalar rho1_, rho2_, mu1_, mu2_, capillaryTimeStep_;
 
+    //- Surface tension, the capillary time step limit is scaled by a safety factor that may exceed one if the force
+    //- is treated semi-implicitly
+    bool semiImplicitSurfaceTension_;
+    Scalar capillaryTimeStepFactor_;
+
+    InterfaceAdvection interfaceAdvectionMethod_;
+    Scalar interfaceMaxCo_;
+
     //- Equations
     Equation<Scalar> gammaEqn_;
+
+    //- Reusable face buffers of the algebraic advection schemes
+    ScalarFiniteVolumeField beta_, gammaF_;
+
+    ReductionBatch::Result gammaChange_;
+
+    //- Persistent halo exchanges, rho and mu are batched
+    HaloExchange gammaHalo_, propertyHalo_;
 };
 
 #endif
\ No newline at end of file
@@ -24,8 +24,12 @@ Scalar FractionalStepMultiphaseQuadraticIbm::solve(Scalar timeStep)
 {
     solveGammaEqn(timeStep);
     solveUEqn(timeStep);
-    solvePEqn(timeStep);
-    correctVelocity(timeStep);
+    solvePEqn(projectionTimeStep(timeStep));
+    correctVelocity(projectionTimeStep(timeStep));
+
+    ReductionBatch reductions(grid_->comm());
+    reduceStepStatistics(reductions, timeStep);
+    reductions.start();
 
     ib_.computeForce(rho, mu, u, p, g_);
     //ib_.computeForce(rho1_, mu1_, u, p, g_);
@@ -35,19 +39,19 @@ Scalar FractionalStepMultiphaseQuadraticIbm::solve(Scalar timeStep)
     for(const Cell& cell: grid_->cells())
         ps(cell) = p(cell) + rho(cell) * dot(g_, cell.centroid());
 
-    grid_->comm().printf("Max divergence error = %.4e\n", grid_->comm().max(maxDivergenceError()));
-    grid_->comm().printf("Max CFL number = %.4lf\n", maxCourantNumber(timeStep));
+    grid_->comm().printf("Max divergence error = %.4e\n", divergenceError_.get());
+    grid_->comm().printf("Max CFL number = %.4lf\n", courantNumber_.get());
 
     return 0;
 }
 
 Scalar FractionalStepMultiphaseQuadraticIbm::solveGammaEqn(Scalar timeStep)
 {
-    auto beta = cicsam::beta(u, gradGamma, gamma, timeStep, 0.5);
+    computeBeta(u, timeStep);
 
     //- Advect volume fractions
-    gamma.savePreviousTimeStep(timeStep, 1);
-    gammaEqn_ = (fv::ddt(gamma, timeStep, fluid_) + cicsam::div(u, beta, gamma, fluid_, 0.5)
+    gamma.savePreviousTimeStep(timeStep, 2);
+    gammaEqn_ = (fv::ddt(gamma, timeStep, fluid_) + cicsam::div(u, beta_, gammaF_, gamma, fluid_, 0.5)
                  + ft.contactLineBcs(ib_) == 0.);
 
     Scalar error = gammaEqn_.solve();
@@ -63,7 +67,7 @@ Scalar FractionalStepMultiphaseQuadraticIbm::solveGammaEqn(Scalar timeStep)
     grid_->sendMessages(gradGamma);
 
     //- Update all other properties
-    computeMomentumFlux(beta, timeStep);
+    computeMomentumFlux(timeStep);
     updateProperties(timeStep);
 
 //    for(const Cell& cell: grid_->localActiveCells())
@@ -126,8 +130,9 @@ Scalar FractionalStepMultiphaseQuadraticIbm::solveGammaEqn(Scalar timeStep)
 
 Scalar FractionalStepMultiphaseQuadraticIbm::solveUEqn(Scalar timeStep)
 {
-    u.savePreviousTimeStep(timeStep, 1);
-    uEqn_ = (fv::ddt(rho, u, timeStep) + fv::div(rhoU, u, 0.5) + ib_.velocityBcs(u)
+    u.savePreviousTimeStep(timeStep, 2);
+    uEqn_ = (fv::ddt(rho, u, timeStep, timeScheme_) + fv::div(rhoU, u, fv::implicitWeight(timeScheme_, 0.5))
+             + ib_.velocityBcs(u)
              == qibm::laplacian(mu, u, ib_) + src::src(ft + sg, fluid_));
 
     Scalar error = uEqn_.solve();
@@ -174,6 +179,7 @@ Scalar FractionalStepMultiphaseQuadraticIbm::solvePEqn(Scalar timeStep)
 {
     pEqn_ = (fv::laplacian(timeStep / rho, p, grid_->localActiveCells()) == src::div(u, grid().localActiveCells()));
 
+    updatePressureTolerance();
     Scalar error = pEqn_.solve();
     grid_->sendMessages(p);
 
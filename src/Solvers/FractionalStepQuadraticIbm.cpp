@@ -17,11 +17,11 @@ FractionalStepQuadraticIbm::FractionalStepQuadraticIbm(const Input &input, std::
 
 Scalar FractionalStepQuadraticIbm::solveUEqn(Scalar timeStep)
 {
-    u.savePreviousTimeStep(timeStep, 1);
+    u.savePreviousTimeStep(timeStep, 2);
     //gradU.compute(fluid_);
     //grid_->sendMessages(gradU);
 
-    uEqn_ = (fv::ddt(u, timeStep) + qibm::div(u, u, ib_) + ib_.velocityBcs(u) == qibm::laplacian(mu_ / rho_, u, ib_));
+    uEqn_ = (fv::ddt(u, timeStep, timeScheme_) + qibm::div(u, u, ib_) + ib_.velocityBcs(u) == qibm::laplacian(mu_ / rho_, u, ib_));
 
     Scalar error = uEqn_.solve();
     grid_->sendMessages(u);
@@ -36,6 +36,7 @@ Scalar FractionalStepQuadraticIbm::solvePEqn(Scalar timeStep)
 {
     pEqn_ = (fv::laplacian(timeStep / rho_, p, grid().localActiveCells()) == src::div(u, grid().localActiveCells()));
 
+    updatePressureTolerance();
     Scalar error = pEqn_.solve();
     grid_->sendMessages(p);
 
@@ -1,3 +1,5 @@
+#include <numeric>
+
 #include "Piso.h"
 #include "FaceInterpolation.h"
 #include "ScalarGradient.h"
@@ -18,7 +20,8 @@ Piso::Piso(const Input &input,
         d(addScalarField("d")),
         uEqn_(input, u, "uEqn"),
         pCorrEqn_(input, pCorr, "pCorrEqn"),
-        fluid_(grid->createCellZone("fluid"))
+        fluid_(grid->createCellZone("fluid")),
+        localTimeStep_(addScalarField("localTimeStep"))
 {
     rho.fill(input.caseInput().get<Scalar>("Properties.rho", 1.));
     mu.fill(input.caseInput().get<Scalar>("Properties.mu", 1.));
@@ -47,6 +50,11 @@ Scalar Piso::solve(Scalar timeStep)
 {
     u.savePreviousTimeStep(timeStep, 1);
 
+    if (steady_)
+        computeLocalTimeSteps(u, timeStep, fluid_, localTimeStep_);
+    else
+        localTimeStep_.fill(timeStep);
+
     for (size_t innerIter = 0; innerIter < nInnerIterations_; ++innerIter)
     {
         u.savePreviousIteration();
@@ -55,6 +63,14 @@ Scalar Piso::solve(Scalar timeStep)
         for (size_t pCorrIter = 0; pCorrIter < nPCorrections_; ++pCorrIter)
         {
             solvePCorrEqn();
+
+            //- Mass imbalance of the predicted face velocities
+            if (steady_ && pCorrIter == 0)
+                continuityResidual_ = std::sqrt(grid_->comm().sum(
+                        std::accumulate(fluid_.begin(), fluid_.end(), 0., [this](Scalar sum, const Cell &cell) {
+                            return sum + m(cell) * m(cell);
+                        })));
+
             correctVelocity();
         }
     }
@@ -101,9 +117,13 @@ Scalar Piso::computeMaxTimeStep(Scalar maxCo, Scalar prevTimeStep) const
 
 Scalar Piso::solveUEqn(Scalar timeStep)
 {
-    uEqn_ = (fv::ddt(rho, u, timeStep) + fv::div(rho*u, u) + ib_.bcs(u) ==
+    uEqn_ = (fv::ddt(rho, u, localTimeStep_, fluid_) + fv::div(rho*u, u) + ib_.bcs(u) ==
              fv::laplacian(mu, u) - src::src(gradP, fluid_));
 
+    //- Taken before relaxation, with u still holding the previous iterate
+    if (steady_)
+        momentumResidual_ = uEqn_.residualNorm();
+
     uEqn_.relax(momentumOmega_);
 
     Scalar error = uEqn_.solve();
@@ -154,7 +174,7 @@ void Piso::rhieChowInterpolation()
     const VectorFiniteVolumeField &uStar = u.prevIteration();
     const VectorFiniteVolumeField &uPrev = u.oldField(0);
     const ScalarFiniteVolumeField &rhoPrev = rho.oldField(0);
-    Scalar dt = u.oldTimeStep(0);
+    const ScalarFiniteVolumeField &dt = localTimeStep_;
 
     d.fill(0.);
     for (const Cell &cell: d.grid().cellZone("fluid"))
@@ -187,7 +207,7 @@ void Piso::rhieChowInterpolation()
                   + (1. - momentumOmega_) * (uStar(face) - (g * uStar(cellP) + (1. - g) * uStar(cellQ)))
                   +
                   (rhof0 * df * uPrev(face) - (g * rhoP0 * dP * uPrev(cellP) + (1. - g) * rhoQ0 * dQ * uPrev(cellQ))) /
-                  dt //- This term is very important!
+                  dt(face) //- This term is very important!
                   - df * gradP(face) + (g * dP * gradP(cellP) + (1. - g) * dQ * gradP(cellQ));
     }
 
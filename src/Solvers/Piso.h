@@ -41,6 +41,9 @@ protected:
     Scalar momentumOmega_, pCorrOmega_;
 
     CellZone &fluid_;
+
+    //- Pseudo time steps of each cell and face, uniform unless in steady mode
+    ScalarFiniteVolumeField &localTimeStep_;
 };
 
 #endif
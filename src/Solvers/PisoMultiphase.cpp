@@ -1,5 +1,6 @@
 #include "PisoMultiphase.h"
 #include "Cicsam.h"
+#include "Plic.h"
 #include "Celeste.h"
 #include "FaceInterpolation.h"
 #include "Source.h"
@@ -24,7 +25,21 @@ PisoMultiphase::PisoMultiphase(const Input &input,
     // volumeIntegrators_ = VolumeIntegrator::initVolumeIntegrators(input, *this);
 
     //- Configuration
-    interfaceAdvectionMethod_ = CICSAM;
+    const std::string advection = input.caseInput().get<std::string>("Solver.interfaceAdvection", "cicsam");
+
+    if (advection == "cicsam")
+        interfaceAdvectionMethod_ = CICSAM;
+    else if (advection == "plic")
+        interfaceAdvectionMethod_ = PLIC;
+    else
+        throw Exception("PisoMultiphase", "PisoMultiphase", "unrecognized interface advection method \"" + advection + "\".");
+
+    //- PLIC is only bounded up to an interface Courant number of 0.5, larger steps are sub-cycled
+    interfaceMaxCo_ = input.caseInput().get<Scalar>("Solver.interfaceMaxCo", plic::courantLimit);
+
+    if (interfaceAdvectionMethod_ == PLIC && (interfaceMaxCo_ <= 0. || interfaceMaxCo_ > plic::courantLimit))
+        throw Exception("PisoMultiphase", "PisoMultiphase", "interface Courant number limit of PLIC must be in (0, 0.5].");
+
     const std::string tmp = input.caseInput().get<std::string>("Solver.surfaceTensionModel");
 
     ft_ = std::make_shared<Celeste>(input, ib_, gamma, rho, mu, u, gradGamma);
@@ -53,6 +68,7 @@ PisoMultiphase::PisoMultiphase(const Input &input,
 Scalar PisoMultiphase::solve(Scalar timeStep)
 {
     u.savePreviousTimeStep(timeStep, 1);
+    localTimeStep_.fill(timeStep);
 
     for (size_t innerIter = 0; innerIter < nInnerIterations_; ++innerIter)
     {
@@ -150,23 +166,65 @@ Scalar PisoMultiphase::solveGammaEqn(Scalar timeStep)
 {
     gamma.savePreviousTimeStep(timeStep, 1);
 
-    auto beta = cicsam::beta(u, gradGamma, gamma, timeStep, 0.5);
+    Scalar error = 0.;
 
     switch (interfaceAdvectionMethod_)
     {
         case CICSAM:
+        {
+            auto beta = cicsam::beta(u, gradGamma, gamma, timeStep, 0.5);
+
             gammaEqn_ = (
                     fv::ddt(gamma, timeStep) + cicsam::div(u, beta, gamma, 0.5) +
                     ib_.bcs(gamma) == 0.);
-    }
 
-    Scalar error = gammaEqn_.solve();
+            error = gammaEqn_.solve();
+
+            grid_->sendMessages(gamma);
 
-    grid_->sendMessages(gamma);
+            gamma.interpolateFaces([this, &beta](const Face& face){
+                return dot(u(face), face.outwardNorm(face.lCell().centroid())) > 0 ? 1. - beta(face): beta(face);
+            });
 
-    gamma.interpolateFaces([this, &beta](const Face& face){
-        return dot(u(face), face.outwardNorm(face.lCell().centroid())) > 0 ? 1. - beta(face): beta(face);
-    });
+            break;
+        }
+        case PLIC:
+        {
+            //- The velocity is fixed over the step, so the Courant number of each sub-cycle is known up front
+            Size nSubCycles = (Size) std::max(std::ceil(maxCourantNumber(timeStep) / interfaceMaxCo_), 1.);
+
+            for (Size i = 0; i < nSubCycles; ++i)
+            {
+                if (i > 0)
+                {
+                    gradGamma.compute(fluid_);
+                    grid_->sendMessages(gradGamma);
+                }
+
+                plic::advect(u, gradGamma, gamma, timeStep / nSubCycles, fluid_);
+
+                //- Fluid cells are already updated, only immersed boundary cells need to be solved for
+                if (!ib_.ibObjPtrs().empty())
+                {
+                    Equation<Scalar> fluidEqn(gamma);
+
+                    for (const Cell &cell: fluid_)
+                    {
+                        fluidEqn.add(cell, cell, 1.);
+                        fluidEqn.addSource(cell, -gamma(cell));
+                    }
+
+                    gammaEqn_ = (fluidEqn + ib_.bcs(gamma) == 0.);
+                    error = std::max(error, gammaEqn_.solve());
+                }
+
+                grid_->sendMessages(gamma);
+                gamma.interpolateFaces();
+            }
+
+            break;
+        }
+    }
 
     gradGamma.compute(fluid_);
 
@@ -10,7 +10,7 @@ public:
 
     enum InterfaceAdvection
     {
-        CICSAM
+        CICSAM, PLIC
     };
 
     PisoMultiphase(const Input &input,
@@ -45,6 +45,7 @@ protected:
     Equation<Scalar> gammaEqn_;
 
     InterfaceAdvection interfaceAdvectionMethod_;
+    Scalar interfaceMaxCo_;
     //CurvatureEvaluation curvatureEvaluationMethod_;
 };
 
@@ -16,6 +16,27 @@ Solver::Solver(const Input &input, std::shared_ptr<FiniteVolumeGrid2D> &grid)
 {
     //- Set simulation time options
     maxTimeStep_ = input.caseInput().get<Scalar>("Solver.timeStep");
+
+    const std::string timeScheme = input.caseInput().get<std::string>("Solver.timeScheme", "euler");
+
+    if (timeScheme == "euler")
+        timeScheme_ = fv::EULER;
+    else if (timeScheme == "bdf2")
+        timeScheme_ = fv::BDF2;
+    else
+        throw Exception("Solver", "Solver", "unrecognized time scheme \"" + timeScheme + "\".");
+
+    steady_ = input.caseInput().get<bool>("Solver.steady", false);
+    localMaxCo_ = steady_ ? input.caseInput().get<Scalar>("Solver.maxCo") : 0.;
+}
+
+Solver::StepStatistics Solver::stepStatistics() const
+{
+    StepStatistics stats;
+    stats.momentumResidual = momentumResidual_;
+    stats.continuityResidual = continuityResidual_;
+
+    return stats;
 }
 
 void Solver::printf(const char *format, ...) const
@@ -29,6 +50,93 @@ void Solver::printf(const char *format, ...) const
     va_end(argsPtr);
 }
 
+void Solver::computeLocalTimeSteps(const VectorFiniteVolumeField &u,
+                                   Scalar timeStep,
+                                   const CellGroup &cells,
+                                   ScalarFiniteVolumeField &localTimeStep) const
+{
+    localTimeStep.fill(timeStep);
+
+    for (const Cell &cell: cells)
+    {
+        Scalar outflow = 0.;
+
+        for (const InteriorLink &nb: cell.neighbours())
+            outflow += std::max(dot(u(nb.face()), nb.outwardNorm()), 0.);
+
+        for (const BoundaryLink &bd: cell.boundaries())
+            outflow += std::max(dot(u(bd.face()), bd.outwardNorm()), 0.);
+
+        if (outflow > 0.)
+            localTimeStep(cell) = std::min(localMaxCo_ * cell.volume() / outflow, timeStep);
+    }
+
+    grid_->sendMessages(localTimeStep);
+
+    //- Faces take the smaller step of their cells
+    for (const Face &face: grid_->interiorFaces())
+        localTimeStep(face) = std::min(localTimeStep(face.lCell()), localTimeStep(face.rCell()));
+
+    for (const Face &face: grid_->boundaryFaces())
+        localTimeStep(face) = localTimeStep(face.lCell());
+}
+
+Scalar Solver::continuityResidualNorm(const VectorFiniteVolumeField &u, const CellGroup &cells) const
+{
+    Scalar sumSqr = 0.;
+
+    for (const Cell &cell: cells)
+    {
+        Scalar div = 0.;
+
+        for (const InteriorLink &nb: cell.neighbours())
+            div += dot(u(nb.face()), nb.outwardNorm());
+
+        for (const BoundaryLink &bd: cell.boundaries())
+            div += dot(u(bd.face()), bd.outwardNorm());
+
+        sumSqr += div * div;
+    }
+
+    return std::sqrt(grid_->comm().sum(sumSqr));
+}
+
+void Solver::saveState()
+{
+    savedIntegerFields_.clear();
+    savedScalarFields_.clear();
+    savedVectorFields_.clear();
+    savedTensorFields_.clear();
+
+    for (const auto &field: integerFields_)
+        savedIntegerFields_.emplace_back(field.second, *field.second);
+
+    for (const auto &field: scalarFields_)
+        savedScalarFields_.emplace_back(field.second, *field.second);
+
+    for (const auto &field: vectorFields_)
+        savedVectorFields_.emplace_back(field.second, *field.second);
+
+    for (const auto &field: tensorFields_)
+        savedTensorFields_.emplace_back(field.second, *field.second);
+}
+
+void Solver::restoreState()
+{
+    //- Only the field base classes are assigned, derived fields keep their references and settings
+    for (const auto &field: savedIntegerFields_)
+        *field.first = field.second;
+
+    for (const auto &field: savedScalarFields_)
+        *field.first = field.second;
+
+    for (const auto &field: savedVectorFields_)
+        *field.first = field.second;
+
+    for (const auto &field: savedTensorFields_)
+        *field.first = field.second;
+}
+
 Scalar Solver::getStartTime(const Input &input) const
 {
     if (input.initialConditionInput().get<std::string>("InitialConditions.type", "") == "restart")
@@ -7,6 +7,7 @@
 #include "TensorFiniteVolumeField.h"
 #include "SparseMatrixSolver.h"
 #include "ImmersedBoundary.h"
+#include "TimeDerivative.h"
 
 class Solver
 {
@@ -31,6 +32,32 @@ public:
     Scalar maxTimeStep() const
     { return maxTimeStep_; }
 
+    //- Upper bound on the time step from limits other than the Courant number
+    virtual Scalar maxStableTimeStep() const
+    { return maxTimeStep_; }
+
+    //- Diagnostics of the last step for adaptive time step control and steady convergence monitoring, negative
+    //- if not computed by the solver. Residuals are unscaled global norms
+    struct StepStatistics
+    {
+        Scalar courantNumber = -1., changeError = -1., divergenceError = -1.;
+        Scalar momentumResidual = -1., continuityResidual = -1.;
+    };
+
+    virtual StepStatistics stepStatistics() const;
+
+    //- Steady state mode, time steps are pseudo time steps that may vary between cells
+    bool steady() const
+    { return steady_; }
+
+    //- Field snapshots, so that a rejected time step can be retried. Immersed boundary motion cannot be undone
+    virtual bool canRestoreState() const
+    { return ib_.ibObjs().empty(); }
+
+    void saveState();
+
+    void restoreState();
+
     Scalar getStartTime(const Input& input) const;
 
     //- Field management
@@ -151,6 +178,15 @@ protected:
 
     virtual void restartSolution();
 
+    //- Pseudo time steps limited by the local Courant number, and by the global time step
+    void computeLocalTimeSteps(const VectorFiniteVolumeField &u,
+                               Scalar timeStep,
+                               const CellGroup &cells,
+                               ScalarFiniteVolumeField &localTimeStep) const;
+
+    //- Global L2 norm of the face flux imbalance of u
+    Scalar continuityResidualNorm(const VectorFiniteVolumeField &u, const CellGroup &cells) const;
+
     std::shared_ptr<FiniteVolumeGrid2D> grid_;
 
     //- Fields and geometries
@@ -159,9 +195,22 @@ protected:
     mutable std::unordered_map<std::string, std::shared_ptr<VectorFiniteVolumeField>> vectorFields_;
     mutable std::unordered_map<std::string, std::shared_ptr<TensorFiniteVolumeField>> tensorFields_;
 
+    //- Field snapshots
+    std::vector<std::pair<std::shared_ptr<FiniteVolumeField<int>>, FiniteVolumeField<int>>> savedIntegerFields_;
+    std::vector<std::pair<std::shared_ptr<ScalarFiniteVolumeField>, ScalarFiniteVolumeField>> savedScalarFields_;
+    std::vector<std::pair<std::shared_ptr<VectorFiniteVolumeField>, VectorFiniteVolumeField>> savedVectorFields_;
+    std::vector<std::pair<std::shared_ptr<TensorFiniteVolumeField>, TensorFiniteVolumeField>> savedTensorFields_;
+
     //- Solver parameters
     Scalar maxTimeStep_;
 
+    fv::TimeScheme timeScheme_;
+
+    //- Steady state mode
+    bool steady_;
+    Scalar localMaxCo_;
+    Scalar momentumResidual_ = -1., continuityResidual_ = -1.;
+
     //- Immersed boundary manager
     ImmersedBoundary ib_;
 };
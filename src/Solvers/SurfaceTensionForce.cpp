@@ -52,32 +52,7 @@ SurfaceTensionForce::SurfaceTensionForce(const Input &input,
 
 void SurfaceTensionForce::computeInterfaceNormals()
 {
-    const VectorFiniteVolumeField &gradGammaTilde = *gradGammaTilde_;
-    VectorFiniteVolumeField &n = *n_;
-
-    for (const Cell &cell: grid_->cellZone("fluid"))
-        n(cell) = gradGammaTilde(cell).magSqr() >= eps_ * eps_ ? -gradGammaTilde(cell).unitVec() : Vector2D(0., 0.);
-
-    //- Boundary faces set from contact line orientation
-    for (const Patch &patch: grid_->patches())
-    {
-        for (const Face &face: patch)
-        {
-            Scalar theta = getTheta(patch);
-
-            if (n(face.lCell()) == Vector2D(0., 0.))
-                n(face) = Vector2D(0., 0.);
-            else
-            {
-                Vector2D t = face.norm().tangentVec().unitVec();
-                t = dot(t, n(face.lCell())) > 0. ? t : -t;
-                Scalar phi = cross(t, face.outwardNorm()) < 0. ? M_PI_2 - theta : theta - M_PI_2;
-                n(face) = t.rotate(phi);
-            }
-        }
-    }
-
-    grid_->sendMessages(n);
+    computeInterfaceNormals(grid_->cellZone("fluid"));
 }
 
 Vector2D SurfaceTensionForce::contactLineNormal(const Cell &lCell,
@@ -125,30 +100,156 @@ void SurfaceTensionForce::smoothGammaField()
 //        Scalar r = (cell.centroid() - kCell.centroid()).mag() / e;
 //        return r < 1. ? pow(1. - r*r, 3) : 0.;
 //    });
-    //- This kernel is better
-    smooth(gamma_, grid().localActiveCells(), grid_->cellZone("fluid"), kernelWidth_, *gammaTilde_,
-           [](const Cell &cell, const Cell &kCell, Scalar e) {
-               Scalar r = (cell.centroid() - kCell.centroid()).mag() / e;
-               return r < 1. ? std::cos(M_PI * r) + 1. : 0.;
-           });
-
-    grid_->sendMessages(*gammaTilde_);
-    gammaTilde_->setBoundaryFaces();
+    smoothGammaField(grid_->localActiveCells(), grid_->cellZone("fluid"));
 }
 
 void SurfaceTensionForce::smoothGammaField(const ImmersedBoundary &ib)
 {
-    CellGroup cellsToSmooth = grid_->localActiveCells() - ib.solidCells();
-
-    smooth(gamma_, cellsToSmooth,
-           grid_->globalCellGroup(cellsToSmooth),
-           kernelWidth_,
-           *gammaTilde_,
-           [](const Cell &cell, const Cell &kCell, Scalar e) {
-               Scalar r = (cell.centroid() - kCell.centroid()).mag() / e;
-               return r < 1. ? std::cos(M_PI * r) + 1. : 0.;
-           });
-
-    grid_->sendMessages(*gammaTilde_);
-    gammaTilde_->setBoundaryFaces();
+    smoothGammaField(grid_->localActiveCells(), nonSolidCells(ib), true);
+}
+
+void SurfaceTensionForce::smoothGammaField(const CellGroup &cellsToSmooth, const CellGroup &kernelCells)
+{
+    //- Cells outside the kernel group, eg solid cells, are dropped from a row and the remaining weights renormalized
+    std::vector<int> inKernel(grid_->cells().size(), 0);
+    for (const Cell &cell: kernelCells)
+        inKernel[cell.id()] = 1;
+
+    smoothGammaField(cellsToSmooth, inKernel, false);
+}
+
+//- Protected methods
+
+void SurfaceTensionForce::smoothGammaField(const CellGroup &cellsToSmooth, const std::vector<int> &inKernel,
+                                           bool skipMasked)
+{
+    if (!smoothingOperatorBuilt_ || smoothingGeometryVersion_ != grid_->geometryVersion())
+        buildSmoothingOperator();
+
+    const ScalarFiniteVolumeField &gamma = gamma_;
+    ScalarFiniteVolumeField &gammaTilde = *gammaTilde_;
+
+    auto cells = cellsToSmooth.begin();
+
+#pragma omp parallel for
+    for (int i = 0; i < cellsToSmooth.size(); ++i)
+    {
+        const Cell &cell = cells[i];
+
+        if (skipMasked && !inKernel[cell.id()])
+            continue;
+
+        Scalar tilde = 0., sumW = 0.;
+
+        for (Label j = smoothingRowPtr_[cell.id()]; j < smoothingRowPtr_[cell.id() + 1]; ++j)
+        {
+            Label k = smoothingCols_[j];
+            Scalar w = inKernel[k] ? smoothingWeights_[j] : 0.;
+
+            tilde += w * gamma[k];
+            sumW += w;
+        }
+
+        gammaTilde(cell) = sumW > 0. ? tilde / sumW : gamma(cell);
+    }
+
+    grid_->sendMessages(gammaTilde);
+    gammaTilde.setBoundaryFaces();
+}
+
+const std::vector<int> &SurfaceTensionForce::nonSolidCells(const ImmersedBoundary &ib)
+{
+    if (nonSolidCellsBuilt_ && nonSolidCellsTopologyVersion_ == grid_->topologyVersion())
+        return nonSolidCells_;
+
+    nonSolidCells_.assign(grid_->cells().size(), 0);
+
+    for (const Cell &cell: grid_->localActiveCells())
+        nonSolidCells_[cell.id()] = 1;
+
+    for (auto ibObj: ib)
+        for (const Cell &cell: ibObj->solidCells())
+            nonSolidCells_[cell.id()] = 0;
+
+    grid_->sendMessages(nonSolidCells_);
+
+    nonSolidCellsBuilt_ = true;
+    nonSolidCellsTopologyVersion_ = grid_->topologyVersion();
+
+    return nonSolidCells_;
+}
+
+void SurfaceTensionForce::computeInterfaceNormals(const CellGroup &cells)
+{
+    const VectorFiniteVolumeField &gradGammaTilde = *gradGammaTilde_;
+    VectorFiniteVolumeField &n = *n_;
+
+    for (const Cell &cell: cells)
+        n(cell) = gradGammaTilde(cell).magSqr() >= eps_ * eps_ ? -gradGammaTilde(cell).unitVec() : Vector2D(0., 0.);
+
+    //- Boundary faces set from contact line orientation
+    for (const Patch &patch: grid_->patches())
+    {
+        for (const Face &face: patch)
+        {
+            Scalar theta = getTheta(patch);
+
+            if (n(face.lCell()) == Vector2D(0., 0.))
+                n(face) = Vector2D(0., 0.);
+            else
+            {
+                Vector2D t = face.norm().tangentVec().unitVec();
+                t = dot(t, n(face.lCell())) > 0. ? t : -t;
+                Scalar phi = cross(t, face.outwardNorm()) < 0. ? M_PI_2 - theta : theta - M_PI_2;
+                n(face) = t.rotate(phi);
+            }
+        }
+    }
+
+    grid_->sendMessages(n);
+}
+
+void SurfaceTensionForce::buildSmoothingOperator()
+{
+    //- This kernel is better
+    auto kernel = [](const Cell &cell, const Cell &kCell, Scalar e) {
+        Scalar r = (cell.centroid() - kCell.centroid()).mag() / e;
+        return r < 1. ? std::cos(M_PI * r) + 1. : 0.;
+    };
+
+    //- Rows are built for the cells owned by this proc, over all local and buffer cells
+    std::vector<bool> isBufferCell(grid_->cells().size(), false);
+    for (const CellZone &bufferZone: grid_->bufferZones())
+        for (const Cell &cell: bufferZone)
+            isBufferCell[cell.id()] = true;
+
+    CellGroup kernelCells;
+    kernelCells.add(grid_->cells().begin(), grid_->cells().end());
+
+    smoothingRowPtr_.assign(1, 0);
+    smoothingCols_.clear();
+    smoothingWeights_.clear();
+
+    for (const Cell &cell: grid_->cells())
+    {
+        if (!isBufferCell[cell.id()])
+        {
+            auto kCells = kernelCells.itemsWithin(Circle(cell.centroid(), kernelWidth_));
+
+            Scalar integralK = 0.;
+            for (const Cell &kCell: kCells)
+                integralK += kernel(cell, kCell, kernelWidth_) * kCell.volume();
+
+            for (const Cell &kCell: kCells)
+            {
+                smoothingCols_.push_back(kCell.id());
+                smoothingWeights_.push_back(kernel(cell, kCell, kernelWidth_) * kCell.volume() / integralK);
+            }
+        }
+
+        smoothingRowPtr_.push_back(smoothingCols_.size());
+    }
+
+    smoothingOperatorBuilt_ = true;
+    smoothingGeometryVersion_ = grid_->geometryVersion();
 }
@@ -82,11 +82,29 @@ public:
 
     void smoothGammaField(const ImmersedBoundary &ib);
 
+    void smoothGammaField(const CellGroup &cellsToSmooth, const CellGroup &kernelCells);
+
     //- Misc special gamma boundary equations
     virtual Equation<Scalar> contactLineBcs(const ImmersedBoundary &ib) = 0;
 
 protected:
 
+    //- Compute the normals of the given cells only
+    void computeInterfaceNormals(const CellGroup &cells);
+
+    //- Smooth with the kernel restricted to cells flagged in inKernel. Unflagged cells are left unchanged if
+    //- skipMasked is set, otherwise they are smoothed from their flagged neighbours
+    void smoothGammaField(const CellGroup &cellsToSmooth, const std::vector<int> &inKernel, bool skipMasked);
+
+    //- Flags the local and buffer cells that are not solid. Only rebuilt when the immersed boundary changes the
+    //- global ordering, since solid cells cannot change otherwise
+    const std::vector<int> &nonSolidCells(const ImmersedBoundary &ib);
+
+    //- Smoothing kernel in CSR format with one row per cell id, holding the normalized weights of all local and
+    //- buffer cells within the kernel width. It depends on the cell geometry only, active and solid cells are
+    //- masked when the kernel is applied, so it is only rebuilt when the cells or buffer zones change
+    void buildSmoothingOperator();
+
     Scalar sigma_, kernelWidth_;
 
     std::unordered_map<Label, Scalar> ibContactAngles_;
@@ -107,6 +125,16 @@ protected:
     std::shared_ptr<ScalarFiniteVolumeField> kappa_, gammaTilde_;
     std::shared_ptr<ScalarGradient> gradGammaTilde_;
     std::shared_ptr<VectorFiniteVolumeField> n_;
+
+    //- Smoothing operator
+    bool smoothingOperatorBuilt_ = false;
+    Size smoothingGeometryVersion_ = 0;
+    std::vector<Label> smoothingRowPtr_, smoothingCols_;
+    std::vector<Scalar> smoothingWeights_;
+
+    bool nonSolidCellsBuilt_ = false;
+    Size nonSolidCellsTopologyVersion_ = 0;
+    std::vector<int> nonSolidCells_;
 };
 
 #endif
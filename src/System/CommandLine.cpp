@@ -1,7 +1,10 @@
 #include <iostream>
+#include <cstdlib>
+#include <climits>
 
 #include "CommandLine.h"
 #include "Exception.h"
+#include "ThreadPool.h"
 
 CommandLine::CommandLine()
 {
@@ -9,7 +12,8 @@ CommandLine::CommandLine()
 
     options_ = map<string, string>{
         {"--help", "Displays this help message"},
-        {"--version", "Displays version information"}
+        {"--version", "Displays version information"},
+        {"--threads", "Number of threads per process"}
     };
 }
 
@@ -43,6 +47,21 @@ void CommandLine::parseArguments(int argc, char *argv[])
         else
             parsedArgs_[argv[argNo]] = argv[argNo + 1];
     }
+
+    auto threads = parsedArgs_.find("--threads");
+
+    if(threads != parsedArgs_.end())
+    {
+        char *end;
+        long nThreads = std::strtol(threads->second.c_str(), &end, 10);
+
+        if(threads->second.empty() || *end != '\0' || nThreads < 1 || nThreads > INT_MAX)
+            throw Exception("CommandLine", "parseArguments", "invalid number of threads \"" + threads->second + "\".");
+
+        ThreadPool::init(nThreads, std::getenv("OMP_PROC_BIND") == nullptr);
+    }
+    else if(!ThreadPool::initialized())
+        ThreadPool::init();
 }
 
 std::string CommandLine::getOption(const std::string &option)
@@ -1,15 +1,29 @@
+#include <cmath>
+
 #include "RunControl.h"
 #include "PostProcessing.h"
+#include "TimeStepController.h"
 
 void RunControl::run(const Input &input, Solver &solver, Viewer &viewer)
 {
+    //- Time
+    Scalar time = solver.getStartTime(input);
+    Scalar timeStep = input.caseInput().get<Scalar>("Solver.initialTimeStep", solver.maxTimeStep());
+
+    if (solver.steady())
+    {
+        runSteady(input, solver, viewer, time, timeStep);
+        return;
+    }
+
     //- Time step conditions
     Scalar maxTime = input.caseInput().get<Scalar>("Solver.maxTime");
     Scalar maxCo = input.caseInput().get<Scalar>("Solver.maxCo");
 
-    //- Time
-    Scalar time = solver.getStartTime(input);
-    Scalar timeStep = input.caseInput().get<Scalar>("Solver.initialTimeStep", solver.maxTimeStep());
+    //- Time step control, rejected steps are retried from a snapshot of the fields
+    std::shared_ptr<TimeStepController> controller = TimeStepController::create(input);
+    bool retrySteps = controller->rejectsSteps() && solver.canRestoreState();
+    int maxRetries = input.caseInput().get<int>("Solver.maxTimeStepRetries", 5);
 
     //- Write control
     size_t fileWriteFrequency = input.caseInput().get<size_t>("System.fileWriteFrequency"), iterNo;
@@ -24,6 +38,9 @@ void RunControl::run(const Input &input, Solver &solver, Viewer &viewer)
     solver.initialize();
     solver.printf("Starting simulation time: %.2lf s\n", time);
 
+    if (controller->rejectsSteps() && !retrySteps)
+        solver.printf("Time steps will not be rejected, the solver state cannot be restored.\n");
+
     //- Post-processing
     PostProcessing postProcessing(input, solver);
 
@@ -31,7 +48,7 @@ void RunControl::run(const Input &input, Solver &solver, Viewer &viewer)
     for (
             iterNo = 0;
             time < maxTime;
-            time += timeStep, timeStep = solver.computeMaxTimeStep(maxCo, timeStep), ++iterNo
+            time += timeStep, timeStep = controller->nextTimeStep(solver, maxCo, timeStep, true), ++iterNo
             )
     {
         if (iterNo % fileWriteFrequency == 0)
@@ -47,7 +64,27 @@ void RunControl::run(const Input &input, Solver &solver, Viewer &viewer)
             //  viewer.write(solver.volumeIntegrators());
         }
 
+        if (retrySteps)
+            solver.saveState();
+
         solver.solve(timeStep);
+
+        for (int retryNo = 0; retrySteps && !controller->accept(solver, maxCo); ++retryNo)
+        {
+            if (retryNo == maxRetries)
+            {
+                solver.printf("Accepting time step after %d retries.\n", maxRetries);
+                break;
+            }
+
+            Scalar rejectedTimeStep = timeStep;
+            timeStep = controller->nextTimeStep(solver, maxCo, timeStep, false);
+            solver.printf("Time step %.2e s rejected, retrying with %.2e s.\n", rejectedTimeStep, timeStep);
+
+            solver.restoreState();
+            solver.solve(timeStep);
+        }
+
         postProcessing.compute(time + timeStep);
 
         time_.stop();
@@ -66,3 +103,73 @@ void RunControl::run(const Input &input, Solver &solver, Viewer &viewer)
     solver.printf("Elapsed CPU time: %s\n", time_.elapsedCpuTime(solver.grid().comm()).c_str());
     solver.printf("%s\n", (std::string(96, '*')).c_str());
 }
+
+void RunControl::runSteady(const Input &input, Solver &solver, Viewer &viewer, Scalar time, Scalar timeStep)
+{
+    Scalar maxCo = input.caseInput().get<Scalar>("Solver.maxCo");
+    size_t maxIterations = input.caseInput().get<size_t>("Solver.maxIterations", 1000);
+    Scalar tolerance = input.caseInput().get<Scalar>("Solver.residualTolerance", 1e-5);
+    size_t fileWriteFrequency = input.caseInput().get<size_t>("System.fileWriteFrequency"), iterNo;
+
+    //- Residuals are scaled by their largest value over the first few iterations
+    const size_t nScalingIterations = 5;
+    Scalar momentumScale = 0., continuityScale = 0.;
+    bool converged = false;
+
+    std::shared_ptr<TimeStepController> controller = TimeStepController::create(input);
+
+    solver.printf("%s\n", (std::string(96, '-')).c_str());
+    solver.printf("%s", solver.info().c_str());
+    solver.printf("%s\n", (std::string(96, '-')).c_str());
+
+    solver.setInitialConditions(input);
+    solver.initialize();
+    solver.printf("Steady state run, residual tolerance: %.2e\n", tolerance);
+
+    PostProcessing postProcessing(input, solver);
+
+    time_.start();
+    for (iterNo = 0; iterNo < maxIterations && !converged; ++iterNo)
+    {
+        if (iterNo % fileWriteFrequency == 0)
+            viewer.write(time);
+
+        solver.solve(timeStep);
+        time += timeStep;
+
+        Solver::StepStatistics stats = solver.stepStatistics();
+
+        if (stats.momentumResidual < 0. || stats.continuityResidual < 0.)
+            throw Exception("RunControl", "runSteady", "solver does not report residuals.");
+
+        if (iterNo < nScalingIterations)
+        {
+            momentumScale = std::max(momentumScale, stats.momentumResidual);
+            continuityScale = std::max(continuityScale, stats.continuityResidual);
+        }
+
+        Scalar momentumResidual = momentumScale > 0. ? stats.momentumResidual / momentumScale : 0.;
+        Scalar continuityResidual = continuityScale > 0. ? stats.continuityResidual / continuityScale : 0.;
+
+        converged = iterNo >= nScalingIterations && momentumResidual < tolerance && continuityResidual < tolerance;
+
+        postProcessing.compute(time);
+
+        time_.stop();
+
+        solver.printf("Pseudo time step: %.2e s\n", timeStep);
+        solver.printf("Residuals: momentum = %.4e, continuity = %.4e\n", momentumResidual, continuityResidual);
+        solver.printf("Average time per iteration: %.2lf s.\n", time_.elapsedSeconds() / (iterNo + 1));
+        solver.printf("%s\n", (std::string(96, '-') + "| End of iteration no " + std::to_string(iterNo + 1)).c_str());
+
+        timeStep = controller->nextTimeStep(solver, maxCo, timeStep, true);
+    }
+    time_.stop();
+
+    viewer.write(time);
+    solver.printf("%s\n", (std::string(96, '*')).c_str());
+    solver.printf(converged ? "Converged in %zu iterations.\n" : "Not converged after %zu iterations.\n", iterNo);
+    solver.printf("Elapsed time: %s\n", time_.elapsedTime().c_str());
+    solver.printf("Elapsed CPU time: %s\n", time_.elapsedCpuTime(solver.grid().comm()).c_str());
+    solver.printf("%s\n", (std::string(96, '*')).c_str());
+}
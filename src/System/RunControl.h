@@ -15,6 +15,14 @@ public:
              Viewer &viewer);
 
 private:
+
+    //- Pseudo time stepping until the scaled residuals drop below the tolerance
+    void runSteady(const Input &input,
+                   Solver &solver,
+                   Viewer &viewer,
+                   Scalar time,
+                   Scalar timeStep);
+
     Time time_;
 };
 
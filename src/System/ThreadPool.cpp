@@ -0,0 +1,88 @@
+#include <cstdlib>
+#include <vector>
+
+#include <sched.h>
+#include <pthread.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "ThreadPool.h"
+#include "Exception.h"
+
+bool ThreadPool::initialized_ = false;
+
+void ThreadPool::init()
+{
+    const char *env = std::getenv("OMP_NUM_THREADS");
+    init(env ? std::atoi(env) : 1, std::getenv("OMP_PROC_BIND") == nullptr);
+}
+
+void ThreadPool::init(int nThreads, bool pinThreads)
+{
+    if (nThreads < 1)
+        throw Exception("ThreadPool", "init", "number of threads must be positive.");
+
+#ifdef _OPENMP
+    omp_set_dynamic(0);
+    omp_set_num_threads(nThreads);
+
+    if (pinThreads && nThreads > 1)
+        ThreadPool::pinThreads();
+#else
+    if (nThreads > 1)
+        throw Exception("ThreadPool", "init", "multiple threads requested but OpenMP support was not compiled in.");
+#endif
+
+    initialized_ = true;
+}
+
+int ThreadPool::nThreads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+int ThreadPool::threadNo()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+//- Private
+
+void ThreadPool::pinThreads()
+{
+#ifdef _OPENMP
+    cpu_set_t processMask;
+    CPU_ZERO(&processMask);
+
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &processMask) != 0)
+        return;
+
+    std::vector<int> cores;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        if (CPU_ISSET(cpu, &processMask))
+            cores.push_back(cpu);
+
+    //- Only pin if the launcher already bound this process to exactly one core per thread. A wider mask is
+    //- usually shared with the other ranks on the node, and pinning to it would stack their threads on the same cores
+    if (cores.size() != nThreads())
+        return;
+
+#pragma omp parallel
+    {
+        cpu_set_t threadMask;
+        CPU_ZERO(&threadMask);
+        CPU_SET(cores[omp_get_thread_num()], &threadMask);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &threadMask);
+    }
+#endif
+}
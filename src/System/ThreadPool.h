@@ -0,0 +1,31 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+//- Per-process team of worker threads. The team is owned by the OpenMP runtime and persists between
+//- parallel regions, so loops annotated with "#pragma omp parallel for" reuse the same pinned threads.
+class ThreadPool
+{
+public:
+
+    //- Set the team size. Uses OMP_NUM_THREADS if set, otherwise a single thread per process.
+    static void init();
+
+    static void init(int nThreads, bool pinThreads = true);
+
+    static bool initialized()
+    { return initialized_; }
+
+    static int nThreads();
+
+    static int threadNo();
+
+private:
+
+    //- Pin each thread to one core of the affinity mask given to this process by the MPI launcher, if that mask
+    //- holds exactly one core per thread
+    static void pinThreads();
+
+    static bool initialized_;
+};
+
+#endif
@@ -0,0 +1,72 @@
+#include "TimeStepController.h"
+#include "Algorithm.h"
+
+std::shared_ptr<TimeStepController> TimeStepController::create(const Input &input)
+{
+    const std::string type = input.caseInput().get<std::string>("Solver.timeStepController", "heuristic");
+
+    if (type == "heuristic")
+        return std::make_shared<HeuristicTimeStepController>();
+    else if (type == "pi")
+        return std::make_shared<PiTimeStepController>(input);
+
+    throw Exception("TimeStepController", "create", "unrecognized time step controller \"" + type + "\".");
+}
+
+Scalar HeuristicTimeStepController::nextTimeStep(const Solver &solver, Scalar maxCo, Scalar timeStep, bool accepted)
+{
+    return solver.computeMaxTimeStep(maxCo, timeStep);
+}
+
+PiTimeStepController::PiTimeStepController(const Input &input)
+{
+    tolerance_ = input.caseInput().get<Scalar>("Solver.timeStepTolerance", 1e-3);
+    maxDivergenceError_ = input.caseInput().get<Scalar>("Solver.maxDivergenceError",
+                                                        std::numeric_limits<Scalar>::infinity());
+    rejectionFactor_ = input.caseInput().get<Scalar>("Solver.timeStepRejectionFactor", 1.5);
+    safety_ = input.caseInput().get<Scalar>("Solver.timeStepSafetyFactor", 0.9);
+    minGrowth_ = input.caseInput().get<Scalar>("Solver.minTimeStepGrowth", 0.2);
+    maxGrowth_ = input.caseInput().get<Scalar>("Solver.maxTimeStepGrowth", 2.);
+
+    if (tolerance_ <= 0. || rejectionFactor_ < 1. || minGrowth_ <= 0. || maxGrowth_ < 1.)
+        throw Exception("PiTimeStepController", "PiTimeStepController", "invalid time step control parameters.");
+}
+
+bool PiTimeStepController::accept(const Solver &solver, Scalar maxCo) const
+{
+    Solver::StepStatistics stats = solver.stepStatistics();
+
+    return stats.courantNumber <= rejectionFactor_ * maxCo
+           && stats.changeError <= rejectionFactor_ * tolerance_
+           && stats.divergenceError <= maxDivergenceError_;
+}
+
+Scalar PiTimeStepController::nextTimeStep(const Solver &solver, Scalar maxCo, Scalar timeStep, bool accepted)
+{
+    Solver::StepStatistics stats = solver.stepStatistics();
+    Scalar growth = maxGrowth_;
+
+    //- The Courant number is linear in the time step
+    if (stats.courantNumber > 0.)
+        growth = std::min(maxCo / stats.courantNumber, growth);
+
+    //- The change error is second order in the time step. The integral gain acts on the current error and the
+    //- proportional gain on its trend, (1/err)^kI (prevErr/err)^kP, only the current error is used after a rejection
+    if (stats.changeError >= 0.)
+    {
+        const Scalar kI = 0.3 / 2., kP = 0.4 / 2.;
+        Scalar error = std::max(stats.changeError / tolerance_, 1e-4);
+
+        growth = std::min(safety_ * (accepted ? std::pow(error, -kI) * std::pow(prevError_ / error, kP)
+                                              : std::pow(error, -0.5)), growth);
+
+        if (accepted)
+            prevError_ = error;
+    }
+
+    //- Divergence errors cannot be controlled smoothly, a violation only shrinks the step
+    if (stats.divergenceError > maxDivergenceError_)
+        growth = std::min(0.5, growth);
+
+    return std::min(clamp(growth, minGrowth_, maxGrowth_) * timeStep, solver.maxStableTimeStep());
+}
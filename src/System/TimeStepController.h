@@ -0,0 +1,60 @@
+#ifndef TIME_STEP_CONTROLLER_H
+#define TIME_STEP_CONTROLLER_H
+
+#include <memory>
+
+#include "Input.h"
+#include "Solver.h"
+
+class TimeStepController
+{
+public:
+
+    static std::shared_ptr<TimeStepController> create(const Input &input);
+
+    virtual ~TimeStepController()
+    {}
+
+    virtual bool rejectsSteps() const
+    { return false; }
+
+    //- Whether the last step satisfies the limits, using the statistics of the solver
+    virtual bool accept(const Solver &solver, Scalar maxCo) const
+    { return true; }
+
+    //- Time step for the next step, or for the retry of a rejected step
+    virtual Scalar nextTimeStep(const Solver &solver, Scalar maxCo, Scalar timeStep, bool accepted) = 0;
+};
+
+//- The solver's own Courant number heuristic
+class HeuristicTimeStepController : public TimeStepController
+{
+public:
+
+    Scalar nextTimeStep(const Solver &solver, Scalar maxCo, Scalar timeStep, bool accepted);
+};
+
+//- Proportional-integral control on the Courant number and on the change error estimate of the solver. Steps
+//- violating the limits by more than a factor, or the divergence limit, are rejected and retried
+class PiTimeStepController : public TimeStepController
+{
+public:
+
+    PiTimeStepController(const Input &input);
+
+    bool rejectsSteps() const
+    { return true; }
+
+    bool accept(const Solver &solver, Scalar maxCo) const;
+
+    Scalar nextTimeStep(const Solver &solver, Scalar maxCo, Scalar timeStep, bool accepted);
+
+private:
+
+    Scalar tolerance_, maxDivergenceError_, rejectionFactor_, safety_, minGrowth_, maxGrowth_;
+
+    //- Normalized change error of the last accepted step
+    Scalar prevError_ = 1.;
+};
+
+#endif
@@ -35,10 +35,9 @@ CgnsViewer::CgnsViewer(const Input &input, const Solver &solver)
     cg_sol_write(fid, bid, zid, "Info", CGNS_ENUMV(CellCenter), &sid);
 
     std::vector<int> procNo(solver.grid().cells().size(), solver.grid().comm().rank());
-    if (!solver.grid().bufferZones().empty())
-        for (int proc = 0; proc < solver.grid().comm().nProcs(); ++proc)
-            for (const Cell &cell: solver.grid().bufferZones()[proc])
-                procNo[cell.id()] = proc;
+    for (int i = 0; i < solver.grid().neighbourProcs().size(); ++i)
+        for (const Cell &cell: solver.grid().bufferZones()[i])
+            procNo[cell.id()] = solver.grid().neighbourProcs()[i];
 
     int fieldId;
     cg_field_write(fid, bid, zid, sid, CGNS_ENUMV(Integer), "ProcNo", procNo.data(), &fieldId);
@@ -0,0 +1,55 @@
+#include <iostream>
+#include <random>
+#include <chrono>
+
+#include "CollisionModel.h"
+
+//- Compares the broad phase collision search against an all pairs search for randomly placed bodies.
+//- Usage: phaseCollisionBenchmark [maxBodies]
+int main(int argc, char *argv[])
+{
+    using namespace std;
+    typedef CollisionModel::BoundingBox BoundingBox;
+
+    Label maxBodies = argc > 1 ? stoul(argv[1]) : 16000;
+    Scalar radius = 0.01, range = 0.005;
+
+    CollisionModel collisionModel(1e-4, range);
+    mt19937 gen(0);
+
+    printf("%10s %12s %12s %14s %14s\n", "nBodies", "nCandidates", "nAllPairs", "broadPhase(s)", "allPairs(s)");
+
+    for (Label nBodies = 250; nBodies <= maxBodies; nBodies *= 2)
+    {
+        //- Keep the solid fraction constant as the number of bodies grows
+        uniform_real_distribution<Scalar> pos(0., sqrt(nBodies) * 10. * radius);
+
+        vector<BoundingBox> boxes;
+        for (Label i = 0; i < nBodies; ++i)
+        {
+            Point2D x(pos(gen), pos(gen));
+            boxes.push_back(BoundingBox(x - Vector2D(radius, radius), x + Vector2D(radius, radius)));
+        }
+
+        auto start = chrono::steady_clock::now();
+        auto pairs = collisionModel.candidatePairs(boxes);
+        auto end = chrono::steady_clock::now();
+        Scalar broadPhaseTime = chrono::duration<Scalar>(end - start).count();
+
+        start = chrono::steady_clock::now();
+        Label nAllPairs = 0;
+        for (Label p = 0; p < nBodies; ++p)
+            for (Label q = p + 1; q < nBodies; ++q)
+            {
+                Vector2D d = boxes[p].min_corner() - boxes[q].min_corner();
+                if (fabs(d.x) <= 2. * radius + range && fabs(d.y) <= 2. * radius + range)
+                    ++nAllPairs;
+            }
+        end = chrono::steady_clock::now();
+        Scalar allPairsTime = chrono::duration<Scalar>(end - start).count();
+
+        printf("%10lu %12lu %12lu %14.6f %14.6f\n", nBodies, pairs.size(), nAllPairs, broadPhaseTime, allPairsTime);
+    }
+
+    return 0;
+}